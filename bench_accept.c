@@ -0,0 +1,222 @@
+// bench_accept.c
+// 접속 준비 비용 비교: 여러 스레드가 동시에 접속할 때의 접속 지연과 초당 수락 수
+//  fifo : 세션별로 미리 만든 FIFO 를 플레이어 0, 1 순서로 open (세션 스레드가 순서대로 열어 줌)
+//  unix : sock_server 의 수신 대기 소켓에 connect 후 WIRE_WELCOME 수신 (epoll 루프 하나가 수락)
+//  자식 프로세스가 서버, 부모 프로세스의 스레드들이 클라이언트 (모두 접속한 뒤 한꺼번에 끊음)
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include "pipe_session.h"
+#include "sock_session.h"
+#include "bench_util.h"
+#include "bench_pipe_bot.h"
+
+#define CONNECTIONS 2000 // 플레이어 접속 수 (게임 CONNECTIONS / 2 판)
+#define THREADS 8        // 동시에 접속하는 클라이언트 스레드 수
+#define BENCH_STACK_SIZE (64 * 1024)
+
+typedef struct
+{
+    int use_socket;
+    const char *path; // 소켓 경로 또는 FIFO 디렉터리
+    int first, count; // 맡은 세션 범위 (fifo) 또는 접속 범위 (unix)
+    int *fds;         // 접속 i 의 fd 두 개 [2i, 2i+1] (끝난 뒤 한꺼번에 닫음, 소켓은 하나만 사용)
+    uint64_t *samples;
+} ConnectArg;
+
+static int connect_socket(const char *path)
+{
+    struct sockaddr_un addr = {.sun_family = AF_UNIX};
+    snprintf(addr.sun_path, sizeof(addr.sun_path), "%s", path);
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd == -1)
+        return -1;
+    if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) == -1)
+    {
+        close(fd);
+        return -1;
+    }
+    WireReader reader;
+    WireMessage msg;
+    wire_reader_init(&reader);
+    if (wire_recv(&reader, fd, &msg) != 1 || msg.type != WIRE_WELCOME)
+    {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static void *connect_thread(void *arg)
+{
+    ConnectArg *c = (ConnectArg *)arg;
+    for (int i = 0; i < c->count; i++)
+    {
+        int idx = c->first + i;
+        uint64_t start = bench_now_ns();
+        if (c->use_socket)
+        {
+            c->fds[2 * idx] = connect_socket(c->path);
+            c->samples[idx] = bench_now_ns() - start;
+            continue;
+        }
+        // fifo: 세션 하나 = 플레이어 접속 두 개
+        for (int p = 0; p < MAX_CLIENTS; p++)
+        {
+            int conn_idx = 2 * idx + p;
+            BenchBotConn conn;
+            start = bench_now_ns();
+            if (bench_bot_open(&conn, c->path, idx, p) == -1)
+                continue;
+            c->samples[conn_idx] = bench_now_ns() - start;
+            c->fds[2 * conn_idx] = conn.to_server;
+            c->fds[2 * conn_idx + 1] = conn.from_server;
+        }
+    }
+    return NULL;
+}
+
+// 자식 프로세스: 서버 (출력과 오류 로그는 버림), ready 에 한 바이트를 쓰면 접속 받을 준비 완료
+static pid_t start_server(int use_socket, const char *path, int ready)
+{
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid != 0)
+        return pid;
+    // 한꺼번에 끊긴 클라이언트에 보내다 실패하는 로그도 버림
+    int devnull = open("/dev/null", O_WRONLY);
+    dup2(devnull, STDOUT_FILENO);
+    dup2(devnull, STDERR_FILENO);
+    close(devnull);
+    bench_raise_fd_limit();
+    signal(SIGPIPE, SIG_IGN);
+    if (use_socket)
+    {
+        SockConfig config;
+        sock_config_default(&config);
+        config.path = path;
+        config.max_games = CONNECTIONS / 2;
+        config.verbose = 0;
+        SockServer server;
+        if (sock_server_init(&server, &config) == -1 || write(ready, "r", 1) != 1)
+            _exit(EXIT_FAILURE);
+        int rc = sock_server_run(&server);
+        sock_server_destroy(&server);
+        _exit(rc == 0 ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+    SessionConfig config;
+    session_config_default(&config);
+    config.count = CONNECTIONS / 2;
+    config.dir = path;
+    config.verbose = 0;
+    config.stack_size = BENCH_STACK_SIZE;
+    SessionTable table;
+    if (session_table_init(&table, &config) == -1 || session_table_start(&table) == -1 ||
+        write(ready, "r", 1) != 1)
+        _exit(EXIT_FAILURE);
+    session_table_join(&table);
+    session_table_destroy(&table);
+    _exit(EXIT_SUCCESS);
+}
+
+static void run(const char *name, int use_socket, const char *dir)
+{
+    char path[SESSION_PATH_MAX];
+    snprintf(path, sizeof(path), "%s/bench.sock", dir);
+    const char *target = use_socket ? path : dir;
+    int ready[2];
+    char byte;
+    if (pipe(ready) == -1)
+    {
+        perror("pipe failed");
+        return;
+    }
+    pid_t pid = start_server(use_socket, target, ready[PIPE_WRITE]);
+    close(ready[PIPE_WRITE]);
+    int started = read(ready[PIPE_READ], &byte, 1) == 1; // 서버가 FIFO/소켓을 다 만들 때까지 대기
+    close(ready[PIPE_READ]);
+    if (!started)
+    {
+        fprintf(stderr, "%s: server failed to start\n", name);
+        waitpid(pid, NULL, 0);
+        return;
+    }
+
+    int *fds = malloc(sizeof(int) * 2 * CONNECTIONS);
+    for (int i = 0; i < 2 * CONNECTIONS; i++)
+        fds[i] = -1;
+    uint64_t *samples = calloc(CONNECTIONS, sizeof(uint64_t));
+    ConnectArg args[THREADS];
+    pthread_t threads[THREADS];
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, BENCH_STACK_SIZE);
+
+    // fifo 는 세션 단위, unix 는 접속 단위로 스레드에 나눔
+    int units = use_socket ? CONNECTIONS : CONNECTIONS / 2;
+    uint64_t begin = bench_now_ns();
+    for (int t = 0; t < THREADS; t++)
+    {
+        args[t].use_socket = use_socket;
+        args[t].path = target;
+        args[t].first = units * t / THREADS;
+        args[t].count = units * (t + 1) / THREADS - args[t].first;
+        args[t].fds = fds;
+        args[t].samples = samples;
+        pthread_create(&threads[t], &attr, connect_thread, &args[t]);
+    }
+    for (int t = 0; t < THREADS; t++)
+        pthread_join(threads[t], NULL);
+    double elapsed = (double)(bench_now_ns() - begin) / 1e9;
+
+    int failed = 0;
+    for (int i = 0; i < CONNECTIONS; i++)
+    {
+        if (fds[2 * i] == -1)
+            failed++;
+    }
+    for (int i = 0; i < 2 * CONNECTIONS; i++)
+    {
+        if (fds[i] != -1)
+            close(fds[i]); // 서버는 접속 종료로 게임을 끝냄
+    }
+    waitpid(pid, NULL, 0);
+
+    bench_sort(samples, CONNECTIONS);
+    printf("%-6s %8d %8d %12.0f %10.1f %10.1f %10.1f\n", name, CONNECTIONS - failed, failed,
+           (CONNECTIONS - failed) / elapsed, bench_percentile(samples, CONNECTIONS, 0.5) / 1e3,
+           bench_percentile(samples, CONNECTIONS, 0.99) / 1e3, bench_percentile(samples, CONNECTIONS, 0.999) / 1e3);
+    fflush(stdout);
+    unlink(path);
+    free(fds);
+    free(samples);
+}
+
+int main(void)
+{
+    bench_raise_fd_limit();
+    signal(SIGPIPE, SIG_IGN);
+    char dir[] = "/tmp/ttt_accept_XXXXXX";
+    if (mkdtemp(dir) == NULL)
+    {
+        perror("mkdtemp failed");
+        return 1;
+    }
+
+    printf("connection setup, %d player connections from %d threads (%ld CPUs)\n", CONNECTIONS, THREADS,
+           sysconf(_SC_NPROCESSORS_ONLN));
+    printf("%-6s %8s %8s %12s %10s %10s %10s\n", "path", "conns", "failed", "accepts/sec", "p50 us", "p99 us",
+           "p99.9 us");
+    run("fifo", 0, dir);
+    run("unix", 1, dir);
+
+    rmdir(dir);
+    return 0;
+}
@@ -0,0 +1,228 @@
+// bench_broadcast.c
+// 관전자 수(1~1000)에 따른 게임판 발행 지연 측정: 프레임 FRAMES 개를 PUBLISH_INTERVAL_NS 간격으로 발행
+//  ring : shm_broadcast_publish (프레임을 링에 한 번 씀) + shm_broadcast_notify (futex 한 번으로 깨움)
+//         관전자는 읽기만 함
+//  pipe : 관전자마다 파이프 하나 (플레이어 FIFO 와 같은 방식, 발행할 때마다 관전자 수만큼 write)
+//         가득 찬 파이프는 기다리지 않고 그 프레임을 버림 (게임을 멈추지 않도록)
+//  publish : 발행 호출 하나의 시간 (서버의 수 적용 경로에 더해지는 시간, pipe 는 write 전부)
+//  notify  : ring 의 깨우기 시간 (서버는 플레이어를 깨운 뒤 호출, 단일 CPU 에서는 깨운 관전자에게 CPU 를 넘긴 시간 포함)
+//  deliver : 발행부터 관전자가 프레임을 읽기까지 (관전자 스레드가 CPU 를 받을 때까지 포함)
+//  skipped : 뒤처져 건너뛰거나 버려진 프레임 (관전자 전체 합)
+//  마지막 두 줄은 프레임마다 SLOW_SPECTATOR_NS 씩 쉬는 느린 관전자 (화면이 느린 터미널):
+//  ring 은 최신 프레임으로 건너뛰고, pipe 는 파이프 버퍼만큼 밀린 옛 프레임을 계속 보여 줌
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "shm_broadcast.h"
+#include "bench_util.h"
+
+#define FRAMES 2000
+#define PUBLISH_INTERVAL_NS 200000 // 5000 프레임/초 (실제 게임보다 훨씬 잦음)
+#define SPECTATOR_STACK (64 * 1024)
+#define SLOW_SPECTATORS 100
+#define SLOW_SPECTATOR_NS 1000000 // 발행 간격의 5배
+
+typedef struct {
+    int use_pipe;
+    long slow_ns;       // 프레임마다 쉬는 시간 (0: 바로 다음 프레임)
+    int fd;             // pipe 모드: 읽는 쪽
+    uint64_t* samples;  // 받은 프레임의 전달 지연
+    int received;
+    uint64_t skipped;
+} Spectator;
+
+static ShmBroadcast* ring;
+
+static void spectator_pause(const Spectator* sp) {
+    if (sp->slow_ns > 0) {
+        struct timespec ts = { .tv_sec = 0, .tv_nsec = sp->slow_ns };
+        nanosleep(&ts, NULL);
+    }
+}
+static pthread_barrier_t ready;
+
+static void* spectator_thread(void* arg) {
+    Spectator* sp = arg;
+    ShmFrame frame;
+    if (sp->use_pipe) {
+        pthread_barrier_wait(&ready);
+        uint32_t expected = 0;
+        while (read(sp->fd, &frame, sizeof(frame)) == sizeof(frame)) {
+            sp->samples[sp->received++] = bench_now_ns() - frame.published_ns;
+            sp->skipped += frame.number - expected; // 가득 차서 버려진 프레임
+            expected = frame.number + 1;
+            if (frame.game_over) {
+                break;
+            }
+            spectator_pause(sp);
+        }
+        return NULL;
+    }
+    ShmBroadcastCursor cursor;
+    shm_broadcast_attach(ring, &cursor);
+    pthread_barrier_wait(&ready);
+    for (;;) {
+        if (!shm_broadcast_read(ring, &cursor, &frame)) {
+            shm_broadcast_wait(ring, &cursor);
+            continue;
+        }
+        sp->samples[sp->received++] = bench_now_ns() - frame.published_ns;
+        if (frame.game_over) {
+            break;
+        }
+        spectator_pause(sp);
+    }
+    sp->skipped = cursor.skipped;
+    return NULL;
+}
+
+static void run(int spectators, int use_pipe, long slow_ns, uint64_t* publish, uint64_t* notify, uint64_t* deliver) {
+    Spectator* sps = calloc((size_t)spectators, sizeof(Spectator));
+    int* write_fds = malloc(sizeof(int) * (size_t)spectators);
+    pthread_t* threads = malloc(sizeof(pthread_t) * (size_t)spectators);
+    memset(ring, 0, sizeof(ShmBroadcast));
+    pthread_barrier_init(&ready, NULL, (unsigned)spectators + 1);
+
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, SPECTATOR_STACK);
+    for (int i = 0; i < spectators; i++) {
+        sps[i].use_pipe = use_pipe;
+        sps[i].slow_ns = slow_ns;
+        sps[i].samples = malloc(sizeof(uint64_t) * FRAMES);
+        if (use_pipe) {
+            int fds[2];
+            if (pipe(fds) == -1) {
+                perror("pipe");
+                exit(EXIT_FAILURE);
+            }
+            fcntl(fds[1], F_SETFL, O_NONBLOCK);
+            sps[i].fd = fds[0];
+            write_fds[i] = fds[1];
+        }
+        pthread_create(&threads[i], &attr, spectator_thread, &sps[i]);
+    }
+    pthread_attr_destroy(&attr);
+    pthread_barrier_wait(&ready);
+
+    ShmFrame frame;
+    memset(&frame, 0, sizeof(frame));
+    frame.winner = -1;
+    frame.last_cell = -1;
+    ttt_init(&frame.board);
+    struct timespec next;
+    clock_gettime(CLOCK_MONOTONIC, &next);
+    for (int f = 0; f < FRAMES; f++) {
+        // 무승부 순서를 되풀이하며 게임판을 바꿈, 마지막 프레임은 게임 종료
+        int cell = bench_draw_script[f % 9];
+        if (f % 9 == 0) {
+            ttt_init(&frame.board);
+        }
+        ttt_place(&frame.board, f % 2, cell);
+        frame.turn = 1 - f % 2;
+        frame.move_count = f + 1;
+        frame.last_cell = cell;
+        frame.game_over = f == FRAMES - 1;
+        frame.number = (uint32_t)f;
+
+        uint64_t start = bench_now_ns();
+        frame.published_ns = start;
+        if (use_pipe) {
+            for (int i = 0; i < spectators; i++) {
+                // 마지막 프레임은 모두에게 전달되어야 관전자가 끝나므로 자리가 날 때까지 다시 시도
+                while (write(write_fds[i], &frame, sizeof(frame)) == -1 && errno == EAGAIN && frame.game_over) {
+                    sched_yield();
+                }
+            }
+        }
+        else {
+            shm_broadcast_publish(ring, &frame);
+        }
+        uint64_t published = bench_now_ns();
+        publish[f] = published - start;
+        if (!use_pipe) {
+            shm_broadcast_notify(ring);
+            notify[f] = bench_now_ns() - published;
+        }
+
+        next.tv_nsec += PUBLISH_INTERVAL_NS;
+        if (next.tv_nsec >= 1000000000) {
+            next.tv_sec++;
+            next.tv_nsec -= 1000000000;
+        }
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+    }
+
+    size_t delivered = 0;
+    uint64_t skipped = 0;
+    for (int i = 0; i < spectators; i++) {
+        pthread_join(threads[i], NULL);
+        memcpy(deliver + delivered, sps[i].samples, sizeof(uint64_t) * (size_t)sps[i].received);
+        delivered += (size_t)sps[i].received;
+        skipped += sps[i].skipped;
+        free(sps[i].samples);
+        if (use_pipe) {
+            close(sps[i].fd);
+            close(write_fds[i]);
+        }
+    }
+    pthread_barrier_destroy(&ready);
+    bench_sort(publish, FRAMES);
+    bench_sort(notify, FRAMES);
+    bench_sort(deliver, delivered);
+    char notify_p50[24] = "-", notify_p99[24] = "-";
+    if (!use_pipe) {
+        snprintf(notify_p50, sizeof(notify_p50), "%llu", (unsigned long long)bench_percentile(notify, FRAMES, 0.5));
+        snprintf(notify_p99, sizeof(notify_p99), "%llu", (unsigned long long)bench_percentile(notify, FRAMES, 0.99));
+    }
+    printf("%10d  %-4s %8llu %8llu %9llu   %9s %9s   %9llu %9llu   %8.1f%%  %9llu\n", spectators,
+           use_pipe ? "pipe" : "ring", (unsigned long long)bench_percentile(publish, FRAMES, 0.5),
+           (unsigned long long)bench_percentile(publish, FRAMES, 0.99),
+           (unsigned long long)bench_percentile(publish, FRAMES, 1.0), notify_p50, notify_p99,
+           (unsigned long long)bench_percentile(deliver, delivered, 0.5) / 1000,
+           (unsigned long long)bench_percentile(deliver, delivered, 0.99) / 1000,
+           100.0 * (double)delivered / ((double)FRAMES * spectators), (unsigned long long)skipped);
+    fflush(stdout);
+    free(sps);
+    free(write_fds);
+    free(threads);
+}
+
+int main(void) {
+    static const int spectator_counts[] = {1, 10, 100, 1000};
+    int max_spectators = spectator_counts[sizeof(spectator_counts) / sizeof(spectator_counts[0]) - 1];
+    if (bench_raise_fd_limit() < 2 * max_spectators + 16) {
+        fprintf(stderr, "fd limit too low for %d pipes\n", max_spectators);
+        return 1;
+    }
+    ring = aligned_alloc(SHM_CACHE_LINE, (sizeof(ShmBroadcast) + SHM_CACHE_LINE - 1) / SHM_CACHE_LINE * SHM_CACHE_LINE);
+    uint64_t* publish = malloc(sizeof(uint64_t) * FRAMES);
+    uint64_t* notify = calloc(FRAMES, sizeof(uint64_t));
+    uint64_t* deliver = malloc(sizeof(uint64_t) * FRAMES * (size_t)max_spectators);
+
+    printf("board broadcast to spectators, %d frames every %d us (%ld CPUs)\n", FRAMES, PUBLISH_INTERVAL_NS / 1000,
+           sysconf(_SC_NPROCESSORS_ONLN));
+    printf("%10s  %-4s %8s %8s %9s   %9s %9s   %9s %9s   %9s  %9s\n", "spectators", "impl", "pub p50", "pub p99",
+           "pub max", "wake p50", "wake p99", "dlv p50", "dlv p99", "delivered", "skipped");
+    printf("%10s  %-4s %8s %8s %9s   %9s %9s   %9s %9s\n", "", "", "(ns)", "(ns)", "(ns)", "(ns)", "(ns)", "(us)",
+           "(us)");
+    for (size_t c = 0; c < sizeof(spectator_counts) / sizeof(spectator_counts[0]); c++) {
+        for (int use_pipe = 0; use_pipe <= 1; use_pipe++) {
+            run(spectator_counts[c], use_pipe, 0, publish, notify, deliver);
+        }
+    }
+    printf("slow spectators (%d us per frame)\n", SLOW_SPECTATOR_NS / 1000);
+    for (int use_pipe = 0; use_pipe <= 1; use_pipe++) {
+        run(SLOW_SPECTATORS, use_pipe, SLOW_SPECTATOR_NS, publish, notify, deliver);
+    }
+
+    free(publish);
+    free(notify);
+    free(deliver);
+    free(ring);
+    return 0;
+}
@@ -0,0 +1,155 @@
+// bench_engine.c
+// 승리/무승부 판정 마이크로벤치마크
+//  legacy2d : 기존 pipe_server.c 의 char[3][3] check_winner + is_draw (출력 제외)
+//  legacy1d : 기존 shmserver.c 의 win_patterns[8][3] check_winner + 빈 칸 세기
+//  bitboard : ttt_engine 의 마스크 테이블 + popcount
+//  table    : 수마다 갱신한 3진수 인덱스로 미리 계산한 상태 표 조회 한 번
+#include <stdio.h>
+#include <stdlib.h>
+#include "ttt_engine.h"
+#include "ttt_solved.h"
+#include "bench_util.h"
+
+#define NUM_BOARDS 4096
+
+typedef struct
+{
+    char grid[3][3];
+    char flat[9];
+    TttBoard bits;
+} BenchBoard;
+
+static BenchBoard boards[NUM_BOARDS];
+
+// 결과 코드: -1 진행 중, 0/1 승자, 2 무승부
+static int legacy2d_eval(char board[3][3])
+{
+    for (int i = 0; i < 3; i++)
+    {
+        if (board[i][0] != ' ' && board[i][0] == board[i][1] && board[i][1] == board[i][2])
+            return board[i][0] == 'X' ? 0 : 1;
+        if (board[0][i] != ' ' && board[0][i] == board[1][i] && board[1][i] == board[2][i])
+            return board[0][i] == 'X' ? 0 : 1;
+    }
+    if (board[0][0] != ' ' && board[0][0] == board[1][1] && board[1][1] == board[2][2])
+        return board[0][0] == 'X' ? 0 : 1;
+    if (board[0][2] != ' ' && board[0][2] == board[1][1] && board[1][1] == board[2][0])
+        return board[0][2] == 'X' ? 0 : 1;
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            if (board[i][j] == ' ')
+                return -1;
+    return 2;
+}
+
+static int legacy1d_eval(const char *board)
+{
+    int win_patterns[8][3] = {
+        {0, 1, 2}, {3, 4, 5}, {6, 7, 8},
+        {0, 3, 6}, {1, 4, 7}, {2, 5, 8},
+        {0, 4, 8}, {2, 4, 6}};
+    for (int i = 0; i < 8; i++)
+    {
+        if (board[win_patterns[i][0]] != ' ' &&
+            board[win_patterns[i][0]] == board[win_patterns[i][1]] &&
+            board[win_patterns[i][1]] == board[win_patterns[i][2]])
+            return board[win_patterns[i][0]] == 'X' ? 0 : 1;
+    }
+    int empty_spaces = 0;
+    for (int i = 0; i < 9; i++)
+        if (board[i] == ' ')
+            empty_spaces++;
+    return empty_spaces == 0 ? 2 : -1;
+}
+
+static int bitboard_eval(const TttBoard *board)
+{
+    int winner = ttt_winner(board);
+    if (winner != -1)
+        return winner;
+    return ttt_is_full(board) ? 2 : -1;
+}
+
+static int table_eval(const TttBoard *board)
+{
+    static const int results[4] = {-1, 0, 1, 2}; // TTT_STATE_* -> 결과 코드
+    return results[TTT_STATE_RESULT(ttt_state(board))];
+}
+
+// 무작위 게임의 중간/최종 국면 생성 (승리가 나면 그 국면에서 멈춤)
+static void make_boards(void)
+{
+    srand(12345);
+    for (int b = 0; b < NUM_BOARDS; b++)
+    {
+        BenchBoard *board = &boards[b];
+        ttt_init(&board->bits);
+        int plies = rand() % (TTT_CELLS + 1);
+        for (int ply = 0; ply < plies && ttt_winner(&board->bits) == -1; ply++)
+        {
+            int cell;
+            do
+                cell = rand() % TTT_CELLS;
+            while (ttt_cell(&board->bits, cell) != -1);
+            ttt_place(&board->bits, ply % 2, cell);
+        }
+        for (int i = 0; i < TTT_CELLS; i++)
+        {
+            board->flat[i] = ttt_cell_char(&board->bits, i);
+            board->grid[i / 3][i % 3] = board->flat[i];
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    long rounds = argc > 1 ? atol(argv[1]) : 5000;
+    make_boards();
+
+    // 네 구현의 판정 결과가 모두 같은지 확인
+    for (int b = 0; b < NUM_BOARDS; b++)
+    {
+        int expect = legacy2d_eval(boards[b].grid);
+        if (legacy1d_eval(boards[b].flat) != expect || bitboard_eval(&boards[b].bits) != expect ||
+            table_eval(&boards[b].bits) != expect)
+        {
+            fprintf(stderr, "mismatch on board %d\n", b);
+            return 1;
+        }
+    }
+
+    long evals = rounds * NUM_BOARDS;
+    long sink = 0;
+    printf("%-10s  %14s  %10s\n", "impl", "evals/sec", "ns/eval");
+
+    uint64_t start = bench_now_ns();
+    for (long r = 0; r < rounds; r++)
+        for (int b = 0; b < NUM_BOARDS; b++)
+            sink += legacy2d_eval(boards[b].grid);
+    uint64_t elapsed = bench_now_ns() - start;
+    printf("%-10s  %14.0f  %10.2f\n", "legacy2d", evals / (elapsed / 1e9), (double)elapsed / evals);
+
+    start = bench_now_ns();
+    for (long r = 0; r < rounds; r++)
+        for (int b = 0; b < NUM_BOARDS; b++)
+            sink += legacy1d_eval(boards[b].flat);
+    elapsed = bench_now_ns() - start;
+    printf("%-10s  %14.0f  %10.2f\n", "legacy1d", evals / (elapsed / 1e9), (double)elapsed / evals);
+
+    start = bench_now_ns();
+    for (long r = 0; r < rounds; r++)
+        for (int b = 0; b < NUM_BOARDS; b++)
+            sink += bitboard_eval(&boards[b].bits);
+    elapsed = bench_now_ns() - start;
+    printf("%-10s  %14.0f  %10.2f\n", "bitboard", evals / (elapsed / 1e9), (double)elapsed / evals);
+
+    start = bench_now_ns();
+    for (long r = 0; r < rounds; r++)
+        for (int b = 0; b < NUM_BOARDS; b++)
+            sink += table_eval(&boards[b].bits);
+    elapsed = bench_now_ns() - start;
+    printf("%-10s  %14.0f  %10.2f\n", "table", evals / (elapsed / 1e9), (double)elapsed / evals);
+
+    printf("(checksum %ld)\n", sink);
+    return 0;
+}
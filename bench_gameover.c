@@ -0,0 +1,257 @@
+// bench_gameover.c
+// 마지막 수를 둔 시점부터 두 플레이어가 게임 종료를 받을 때까지의 지연 측정
+//  pipe: 같은 프로세스에서 세션 테이블과 봇을 실행
+//  shm : ./shmserver 를 실행하고 두 플레이어 역할로 공유 메모리에 수를 둠
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <string.h>
+#include <signal.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include <sys/wait.h>
+#include "pipe_session.h"
+#include "shm_common.h"
+#include "bench_util.h"
+#include "bench_pipe_bot.h"
+
+// X가 0, 1, 2번 칸으로 5수 만에 승리하는 순서
+static const int win_script[5] = {0, 3, 1, 4, 2};
+#define WIN_SCRIPT_LEN 5
+
+typedef struct
+{
+    const char *dir;
+    uint64_t latency_ns;
+} PipeRound;
+
+static void *pipe_bot(void *arg)
+{
+    PipeRound *round = (PipeRound *)arg;
+    BenchBotConn conn[MAX_CLIENTS];
+    for (int p = 0; p < MAX_CLIENTS; p++)
+    {
+        if (bench_bot_open(&conn[p], round->dir, 0, p) == -1)
+            return NULL;
+    }
+
+    uint64_t final_move = 0;
+    for (int i = 0; i < WIN_SCRIPT_LEN; i++)
+    {
+        int p = i % 2;
+        if (bench_bot_wait(&conn[p], WIRE_YOUR_TURN) == -1)
+            break;
+        if (i == WIN_SCRIPT_LEN - 1)
+            final_move = bench_now_ns();
+        bench_bot_move(&conn[p], win_script[i]);
+    }
+
+    // 두 플레이어 모두 Game Over 를 받은 시점
+    for (int p = 0; p < MAX_CLIENTS; p++)
+        bench_bot_wait(&conn[p], WIRE_GAME_OVER);
+    round->latency_ns = bench_now_ns() - final_move;
+
+    for (int p = 0; p < MAX_CLIENTS; p++)
+        bench_bot_close(&conn[p]);
+    return NULL;
+}
+
+static void report(const char *name, uint64_t *samples, int n)
+{
+    bench_sort(samples, n);
+    printf("%-6s %6d  %12.1f  %12.1f  %12.1f  %12.1f\n", name, n,
+           bench_percentile(samples, n, 0.0) / 1e3,
+           bench_percentile(samples, n, 0.5) / 1e3,
+           bench_percentile(samples, n, 0.99) / 1e3,
+           bench_percentile(samples, n, 1.0) / 1e3);
+    fflush(stdout);
+}
+
+static void bench_pipe(int rounds)
+{
+    char dir[] = "/tmp/ttt_gameover_XXXXXX";
+    if (mkdtemp(dir) == NULL)
+    {
+        perror("mkdtemp failed");
+        return;
+    }
+    uint64_t *samples = calloc(rounds, sizeof(uint64_t));
+
+    // 게임 규칙의 콘솔 출력은 측정 중에 버림
+    fflush(stdout);
+    int saved_stdout = dup(STDOUT_FILENO);
+    int devnull = open("/dev/null", O_WRONLY);
+    dup2(devnull, STDOUT_FILENO);
+    close(devnull);
+
+    SessionConfig config;
+    session_config_default(&config);
+    config.dir = dir;
+    config.verbose = 0;
+
+    for (int r = 0; r < rounds; r++)
+    {
+        SessionTable table;
+        if (session_table_init(&table, &config) == -1)
+            break;
+        PipeRound round = {dir, 0};
+        pthread_t bot;
+        pthread_create(&bot, NULL, pipe_bot, &round);
+        session_table_start(&table);
+        session_table_join(&table);
+        pthread_join(bot, NULL);
+        session_table_destroy(&table);
+        samples[r] = round.latency_ns;
+    }
+
+    fflush(stdout);
+    dup2(saved_stdout, STDOUT_FILENO);
+    close(saved_stdout);
+
+    report("pipe", samples, rounds);
+    free(samples);
+    rmdir(dir);
+}
+
+// shmserver 의 화면 출력을 버리는 스레드
+static void *drain_thread(void *arg)
+{
+    int fd = *(int *)arg;
+    char buffer[4096];
+    while (read(fd, buffer, sizeof(buffer)) > 0)
+        ;
+    close(fd);
+    return NULL;
+}
+
+// shmserver 한 판: 두 플레이어 역할로 수를 두고 마지막 수 이후 game_over 까지의 지연 반환
+static int shm_round(const char *server_path, uint64_t *latency)
+{
+    // 이전 실행에서 남은 세그먼트 제거
+    int stale = shmget(SHM_KEY, 0, 0666);
+    if (stale >= 0)
+        shmctl(stale, IPC_RMID, NULL);
+
+    int out[2];
+    if (pipe(out) == -1)
+        return -1;
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        dup2(out[1], STDOUT_FILENO);
+        int devnull = open("/dev/null", O_WRONLY);
+        dup2(devnull, STDERR_FILENO);
+        close(out[0]);
+        close(out[1]);
+        execl(server_path, server_path, (char *)NULL);
+        _exit(127);
+    }
+    close(out[1]);
+
+    // 서버가 공유 메모리 초기화를 마치고 시작 메시지를 출력할 때까지 대기
+    char line[256];
+    size_t len = 0;
+    while (len < sizeof(line) - 1)
+    {
+        ssize_t n = read(out[0], line + len, 1);
+        if (n <= 0)
+            break;
+        if (line[len++] == '\n')
+            break;
+    }
+    line[len] = '\0';
+    if (strstr(line, "서버가 시작") == NULL)
+    {
+        fprintf(stderr, "shmserver did not start (%s)\n", server_path);
+        close(out[0]);
+        waitpid(pid, NULL, 0);
+        return -1;
+    }
+    pthread_t drain;
+    pthread_create(&drain, NULL, drain_thread, &out[0]);
+
+    int shm_id = shmget(SHM_KEY, sizeof(SharedMemory), 0666);
+    SharedMemory *segment = (SharedMemory *)shmat(shm_id, NULL, 0);
+    if (shm_id < 0 || segment == (void *)-1)
+    {
+        perror("shm attach failed");
+        kill(pid, SIGTERM);
+        waitpid(pid, NULL, 0);
+        pthread_join(drain, NULL);
+        return -1;
+    }
+
+    // 게임 0 의 두 자리를 차지해 두 플레이어로 접속
+    ShmGame *shm = &segment->games[0];
+    uint64_t mask[SHM_SEAT_WORDS];
+    shm_seat_mask(0, mask);
+    shm_claim_seat(segment, mask);
+    shm_claim_seat(segment, mask);
+
+    uint64_t final_move = 0;
+    for (int i = 0; i < WIN_SCRIPT_LEN; i++)
+    {
+        int p = i % 2;
+        for (;;)
+        {
+            uint32_t seen = shm_event_prepare(&shm->player_event[p]);
+            if (shm->turn == p || shm->game_over)
+                break;
+            shm_event_wait(&shm->player_event[p], seen);
+        }
+        if (i == WIN_SCRIPT_LEN - 1)
+            final_move = bench_now_ns();
+        // 명령 링으로 수 요청 (서버가 검증 후 적용)
+        ShmCommand cmd = {.cell = win_script[i], .seq = (uint32_t)(i / 2 + 1), .sent_ns = bench_now_ns()};
+        shm_ring_push(&shm->commands[p], &cmd);
+        shm_game_notify(segment, shm);
+    }
+
+    // 마지막 수를 둔 플레이어에게 게임 종료가 전달될 때까지 대기
+    int last = (WIN_SCRIPT_LEN - 1) % 2;
+    for (;;)
+    {
+        uint32_t seen = shm_event_prepare(&shm->player_event[last]);
+        if (shm->game_over)
+            break;
+        shm_event_wait(&shm->player_event[last], seen);
+    }
+    *latency = bench_now_ns() - final_move;
+
+    shmdt(segment);
+    waitpid(pid, NULL, 0);
+    pthread_join(drain, NULL);
+    return 0;
+}
+
+static void bench_shm(const char *server_path, int rounds)
+{
+    uint64_t *samples = calloc(rounds, sizeof(uint64_t));
+    int done = 0;
+    for (int r = 0; r < rounds; r++)
+    {
+        if (shm_round(server_path, &samples[done]) == 0)
+            done++;
+    }
+    if (done > 0)
+        report("shm", samples, done);
+    free(samples);
+}
+
+int main(int argc, char *argv[])
+{
+    // 인자: [pipe 반복 수] [shm 반복 수] [shmserver 경로]
+    int pipe_rounds = argc > 1 ? atoi(argv[1]) : 200;
+    int shm_rounds = argc > 2 ? atoi(argv[2]) : 5;
+    const char *server_path = argc > 3 ? argv[3] : "./shmserver";
+
+    printf("final move -> Game Over delivered to both players (usec)\n");
+    printf("%-6s %6s  %12s  %12s  %12s  %12s\n", "path", "games", "min", "p50", "p99", "max");
+    if (pipe_rounds > 0)
+        bench_pipe(pipe_rounds);
+    if (shm_rounds > 0)
+        bench_shm(server_path, shm_rounds);
+    return 0;
+}
@@ -0,0 +1,186 @@
+// bench_handoff.c
+// 두 프로세스가 차례를 주고받는 핑퐁으로 턴 전달 비용 측정
+//  usleep poll : 기존 방식 (0.1초마다 turn 확인)
+//  cond bcast  : 공유 cond 하나에 모두가 대기, 턴마다 broadcast (대기 중인 다른 스레드도 깨어남)
+//  futex event : 플레이어별 이벤트 (shm_event.h), 차례가 된 플레이어만 깨움
+//  각 방식 모두 관계없는 대기 스레드 BYSTANDERS 개를 함께 띄움 (서버의 다른 스레드 역할)
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include "shm_common.h"
+#include "bench_util.h"
+
+#define HANDOFFS 100000
+#define POLL_HANDOFFS 10
+#define BYSTANDERS 4
+
+typedef enum { MODE_POLL, MODE_COND, MODE_FUTEX } Mode;
+
+typedef struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    volatile int turn;
+    volatile int stop;
+    ShmEvent player_event[2];
+    ShmEvent bystander_event;
+    _Atomic long bystander_wakeups;
+} BenchShared;
+
+static BenchShared* shared;
+static Mode mode;
+
+static void give_turn(int next) {
+    switch (mode) {
+    case MODE_POLL:
+        shared->turn = next;
+        break;
+    case MODE_COND:
+        pthread_mutex_lock(&shared->mutex);
+        shared->turn = next;
+        pthread_cond_broadcast(&shared->cond);
+        pthread_mutex_unlock(&shared->mutex);
+        break;
+    case MODE_FUTEX:
+        shared->turn = next;
+        shm_event_signal(&shared->player_event[next]);
+        break;
+    }
+}
+
+static void wait_turn(int me) {
+    switch (mode) {
+    case MODE_POLL:
+        while (shared->turn != me && !shared->stop) {
+            usleep(100000);
+        }
+        break;
+    case MODE_COND:
+        pthread_mutex_lock(&shared->mutex);
+        while (shared->turn != me && !shared->stop) {
+            pthread_cond_wait(&shared->cond, &shared->mutex);
+        }
+        pthread_mutex_unlock(&shared->mutex);
+        break;
+    case MODE_FUTEX:
+        for (;;) {
+            uint32_t seen = shm_event_prepare(&shared->player_event[me]);
+            if (shared->turn == me || shared->stop) {
+                break;
+            }
+            shm_event_wait(&shared->player_event[me], seen);
+        }
+        break;
+    }
+}
+
+// 자기 차례가 오지 않는 대기자 (깨어난 횟수만 셈)
+static void* bystander(void* arg) {
+    (void)arg;
+    if (mode == MODE_COND) {
+        pthread_mutex_lock(&shared->mutex);
+        while (!shared->stop) {
+            pthread_cond_wait(&shared->cond, &shared->mutex);
+            atomic_fetch_add(&shared->bystander_wakeups, 1);
+        }
+        pthread_mutex_unlock(&shared->mutex);
+    }
+    else {
+        for (;;) {
+            uint32_t seen = shm_event_prepare(&shared->bystander_event);
+            if (shared->stop) {
+                break;
+            }
+            shm_event_wait(&shared->bystander_event, seen);
+            atomic_fetch_add(&shared->bystander_wakeups, 1);
+        }
+    }
+    return NULL;
+}
+
+static void run(const char* name, Mode m, int handoffs) {
+    mode = m;
+    shared->turn = 0;
+    shared->stop = 0;
+    shm_event_init(&shared->player_event[0]);
+    shm_event_init(&shared->player_event[1]);
+    shm_event_init(&shared->bystander_event);
+    atomic_store(&shared->bystander_wakeups, 0);
+
+    pthread_t bystanders[BYSTANDERS];
+    for (int i = 0; i < BYSTANDERS; i++) {
+        pthread_create(&bystanders[i], NULL, bystander, NULL);
+    }
+    usleep(10000); // 대기자가 잠들 시간
+
+    pid_t pid = fork();
+    if (pid == 0) {
+        // 플레이어 1: 차례를 받으면 바로 넘김
+        for (int i = 0; i < handoffs; i++) {
+            wait_turn(1);
+            give_turn(0);
+        }
+        _exit(0);
+    }
+
+    int rounds = handoffs;
+    uint64_t* samples = malloc(sizeof(uint64_t) * rounds);
+    uint64_t begin = bench_now_ns();
+    for (int i = 0; i < rounds; i++) {
+        uint64_t start = bench_now_ns();
+        give_turn(1);
+        wait_turn(0);
+        samples[i] = (bench_now_ns() - start) / 2; // 왕복 = 턴 전달 2번
+    }
+    double total = (double)(bench_now_ns() - begin);
+    waitpid(pid, NULL, 0);
+
+    pthread_mutex_lock(&shared->mutex);
+    shared->stop = 1;
+    pthread_cond_broadcast(&shared->cond);
+    pthread_mutex_unlock(&shared->mutex);
+    shm_event_signal(&shared->bystander_event);
+    for (int i = 0; i < BYSTANDERS; i++) {
+        pthread_join(bystanders[i], NULL);
+    }
+
+    bench_sort(samples, rounds);
+    printf("%-12s %8d  %12.0f  %10.2f  %10.2f  %14.2f\n", name, 2 * rounds,
+           2 * rounds / total * 1e9,
+           bench_percentile(samples, rounds, 0.5) / 1e3,
+           bench_percentile(samples, rounds, 0.99) / 1e3,
+           (double)atomic_load(&shared->bystander_wakeups) / (2 * rounds));
+    fflush(stdout);
+    free(samples);
+}
+
+int main(void) {
+    shared = mmap(NULL, sizeof(BenchShared), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (shared == MAP_FAILED) {
+        perror("mmap failed");
+        return 1;
+    }
+    pthread_mutexattr_t mutex_attr;
+    pthread_condattr_t cond_attr;
+    pthread_mutexattr_init(&mutex_attr);
+    pthread_mutexattr_setpshared(&mutex_attr, PTHREAD_PROCESS_SHARED);
+    pthread_condattr_init(&cond_attr);
+    pthread_condattr_setpshared(&cond_attr, PTHREAD_PROCESS_SHARED);
+    pthread_mutex_init(&shared->mutex, &mutex_attr);
+    pthread_cond_init(&shared->cond, &cond_attr);
+
+    printf("turn handoff ping-pong between two processes, %d bystander waiters (%ld CPUs)\n",
+           BYSTANDERS, sysconf(_SC_NPROCESSORS_ONLN));
+    printf("%-12s %8s  %12s  %10s  %10s  %14s\n", "path", "handoffs", "handoffs/sec", "p50 us", "p99 us",
+           "stray wakeups");
+    run("usleep poll", MODE_POLL, POLL_HANDOFFS);
+    run("cond bcast", MODE_COND, HANDOFFS);
+    run("futex event", MODE_FUTEX, HANDOFFS);
+
+    pthread_mutex_destroy(&shared->mutex);
+    pthread_cond_destroy(&shared->cond);
+    munmap(shared, sizeof(BenchShared));
+    return 0;
+}
@@ -0,0 +1,148 @@
+// bench_journal.c
+// 수 기록(journal) 쓰기 처리량 비교: 레코드 RECORDS 개 (16바이트)
+//  mmap   : journal_move (미리 할당하고 미리 채운 공유 매핑에 저장, 시스템 호출 없음)
+//  write  : 레코드마다 write(2) 한 번
+//  stdio  : fwrite 로 버퍼에 모았다가 한꺼번에 씀 (시스템 호출은 적지만 프로세스가 죽으면 버퍼째 사라짐)
+//  페이지 폴트 수로 기록 경로에서 커널에 들어가는 일이 없는지 확인 (mmap 은 열 때 MAP_POPULATE)
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/resource.h>
+#include "journal.h"
+#include "bench_util.h"
+
+#define RECORDS JOURNAL_CAPACITY
+#define MAX_THREADS 4
+
+static char path[] = "/tmp/ttt_journal_XXXXXX";
+
+static long minor_faults(void)
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_minflt;
+}
+
+static void print_row(const char *impl, int threads, uint64_t elapsed, long faults)
+{
+    printf("%-6s %7d  %14.0f  %8.2f  %8ld\n", impl, threads, RECORDS / (elapsed / 1e9), (double)elapsed / RECORDS,
+           faults);
+    fflush(stdout);
+}
+
+typedef struct
+{
+    unsigned id, threads;
+} Writer;
+
+// 스레드마다 다른 세션의 수를 기록 (서버의 작업자들처럼)
+static void *journal_writer(void *arg)
+{
+    Writer *writer = arg;
+    for (unsigned i = writer->id; i < RECORDS; i += writer->threads)
+        journal_move((int)writer->id, i & 1, bench_draw_script[i % 9]);
+    return NULL;
+}
+
+static void run_mmap(int threads)
+{
+    if (journal_open(path, "bench_journal", 3, 3, 3, RECORDS) == -1)
+        exit(EXIT_FAILURE);
+    pthread_t tids[MAX_THREADS];
+    Writer writers[MAX_THREADS];
+    long faults = minor_faults();
+    uint64_t start = bench_now_ns();
+    for (int t = 0; t < threads; t++)
+    {
+        writers[t] = (Writer){.id = (unsigned)t, .threads = (unsigned)threads};
+        pthread_create(&tids[t], NULL, journal_writer, &writers[t]);
+    }
+    for (int t = 0; t < threads; t++)
+        pthread_join(tids[t], NULL);
+    uint64_t elapsed = bench_now_ns() - start;
+    faults = minor_faults() - faults;
+    journal_close();
+    print_row("mmap", threads, elapsed, faults);
+}
+
+static void run_write(void)
+{
+    int fd = open(path, O_CREAT | O_TRUNC | O_WRONLY, 0644);
+    if (fd == -1)
+    {
+        perror("open");
+        exit(EXIT_FAILURE);
+    }
+    JournalRecord record;
+    memset(&record, 0, sizeof(record));
+    long faults = minor_faults();
+    uint64_t start = bench_now_ns();
+    for (unsigned i = 0; i < RECORDS; i++)
+    {
+        record.timestamp_ns = bench_now_ns();
+        record.cell = (uint16_t)bench_draw_script[i % 9];
+        record.player = (uint8_t)(i & 1);
+        record.type = JOURNAL_MOVE;
+        if (write(fd, &record, sizeof(record)) != sizeof(record))
+        {
+            perror("write");
+            exit(EXIT_FAILURE);
+        }
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+    faults = minor_faults() - faults;
+    close(fd);
+    print_row("write", 1, elapsed, faults);
+}
+
+static void run_stdio(void)
+{
+    FILE *file = fopen(path, "w");
+    if (file == NULL)
+    {
+        perror("fopen");
+        exit(EXIT_FAILURE);
+    }
+    JournalRecord record;
+    memset(&record, 0, sizeof(record));
+    long faults = minor_faults();
+    uint64_t start = bench_now_ns();
+    for (unsigned i = 0; i < RECORDS; i++)
+    {
+        record.timestamp_ns = bench_now_ns();
+        record.cell = (uint16_t)bench_draw_script[i % 9];
+        record.player = (uint8_t)(i & 1);
+        record.type = JOURNAL_MOVE;
+        fwrite(&record, sizeof(record), 1, file);
+    }
+    fflush(file);
+    uint64_t elapsed = bench_now_ns() - start;
+    faults = minor_faults() - faults;
+    fclose(file);
+    print_row("stdio", 1, elapsed, faults);
+}
+
+int main(void)
+{
+    int fd = mkstemp(path);
+    if (fd == -1)
+    {
+        perror("mkstemp");
+        return 1;
+    }
+    close(fd);
+
+    printf("journal write throughput, %u records of %zu bytes (%ld CPUs)\n", RECORDS, sizeof(JournalRecord),
+           sysconf(_SC_NPROCESSORS_ONLN));
+    printf("%-6s %7s  %14s  %8s  %8s\n", "impl", "threads", "records/sec", "ns/rec", "faults");
+    for (int threads = 1; threads <= MAX_THREADS; threads *= 2)
+        run_mmap(threads);
+    run_write();
+    run_stdio();
+
+    unlink(path);
+    return 0;
+}
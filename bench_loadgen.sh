@@ -0,0 +1,29 @@
+#!/bin/sh
+# bench_loadgen.sh
+# 봇 클라이언트(./bot)로 두 서버에 부하를 걸고 초당 수와 턴 왕복 지연 측정
+#  FIFO: ./server -s N 을 띄우고 세션 N 개를 동시에 진행 (3x3 스크립트, 15x15 무작위)
+#  shm : ./shmserver -g N 을 띄우고 게임 N 개를 동시에 진행 (N 은 최대 128)
+#  사용법: ./bench_loadgen.sh [sessions]
+SESSIONS=${1:-200}
+DIR=$(mktemp -d /tmp/ttt_loadgen_XXXXXX)
+
+# $@: 서버 추가 인자
+run_fifo() {
+    ./server -s "$SESSIONS" -d "$DIR" "$@" > /dev/null 2>&1 &
+    SERVER_PID=$!
+    sleep 0.5
+    ./bot -t fifo -s "$SESSIONS" -d "$DIR" $MODE
+    wait $SERVER_PID
+}
+
+MODE="-m script" run_fifo
+MODE="-m random" run_fifo -b 15x15 -k 5
+
+GAMES=$((SESSIONS < 128 ? SESSIONS : 128))
+./shmserver -g "$GAMES" > /dev/null 2>&1 &
+SERVER_PID=$!
+sleep 0.5
+./bot -t shm -s "$GAMES"
+kill $SERVER_PID 2> /dev/null
+wait $SERVER_PID 2> /dev/null
+rm -rf "$DIR"
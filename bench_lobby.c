@@ -0,0 +1,371 @@
+// bench_lobby.c
+// 매칭 대기열 측정
+//  1) 대기열 연산 비용: 대기자 N 명이 있는 상태에서 넣기/중간에서 빼기/짝짓기 한 번의 비용 (N 과 무관해야 함)
+//  2) 도착 폭주: sock_server 에 ARRIVALS 개 접속이 한꺼번에 몰릴 때 접속부터 짝지어질 때까지의 시간
+//     (짝지어진 시각은 서버가 WIRE_WELCOME 헤더에 넣은 CLOCK_MONOTONIC 시각)
+//  3) 재입장: 두 접속이 한 판을 끝까지 둔 뒤 WIRE_REQUEUE 를 보내 다시 짝지어지기를 REQUEUE_ROUNDS 번 반복
+//     재입장 요청부터 새 게임의 WIRE_WELCOME 까지의 시간, 짝지어지지 않은 판이 있으면 실패로 끝남
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include "sock_session.h"
+#include "lobby.h"
+#include "bench_util.h"
+
+#define ARRIVALS 10000
+#define THREADS 16
+#define OPS 1000000
+#define BENCH_STACK_SIZE (64 * 1024)
+#define REQUEUE_ROUNDS 1000
+
+typedef struct
+{
+    int fd;
+    WireReader reader;
+} LobbyPlayer;
+
+typedef struct
+{
+    const char *path;
+    int first, count;
+    int *fds;
+    uint64_t *connect_ns; // 접속 시작 시각
+    uint64_t *samples;    // 접속 시작부터 짝지어질 때까지 (ns)
+} ArrivalArg;
+
+// 대기자 depth 명을 유지하면서 중간 이탈(빼기 + 다시 넣기)과 짝짓기(앞의 두 명) + 재입장을 반복
+// 반환: 연산(넣기/빼기/짝짓기) 하나의 평균 ns
+static double queue_ops(int depth)
+{
+    LobbyEntry *entries = calloc(depth, sizeof(LobbyEntry));
+    Lobby lobby;
+    lobby_init(&lobby);
+    for (int i = 0; i < depth; i++)
+    {
+        lobby_entry_init(&entries[i]);
+        lobby_push(&lobby, &entries[i], 0);
+    }
+
+    unsigned seed = 1;
+    uint64_t start = bench_now_ns();
+    for (int op = 0; op < OPS; op++)
+    {
+        // 대기 중 접속 종료 후 재접속: 임의의 대기자를 빼서 맨 뒤에 다시 넣음
+        LobbyEntry *victim = &entries[rand_r(&seed) % depth];
+        lobby_remove(&lobby, victim);
+        lobby_push(&lobby, victim, op);
+        // 맨 앞의 두 명을 짝짓고, 게임이 끝난 두 명이 다시 들어온 것으로 봄
+        LobbyEntry *first, *second;
+        lobby_pair(&lobby, &first, &second);
+        lobby_push(&lobby, first, op);
+        lobby_push(&lobby, second, op);
+    }
+    double ns = (double)(bench_now_ns() - start) / OPS / 5; // 반복 한 번에 연산 5개
+    free(entries);
+    return ns;
+}
+
+static void *arrival_thread(void *arg)
+{
+    ArrivalArg *a = (ArrivalArg *)arg;
+    struct sockaddr_un addr = {.sun_family = AF_UNIX};
+    snprintf(addr.sun_path, sizeof(addr.sun_path), "%s", a->path);
+
+    // 폭주: 맡은 접속을 쉬지 않고 모두 연결
+    for (int i = a->first; i < a->first + a->count; i++)
+    {
+        a->connect_ns[i] = bench_now_ns();
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd != -1 && connect(fd, (struct sockaddr *)&addr, sizeof(addr)) == -1)
+        {
+            close(fd);
+            fd = -1;
+        }
+        a->fds[i] = fd;
+    }
+
+    // 짝지어졌다는 WELCOME 이 올 때까지 (대기열 입장 WELCOME 은 건너뜀)
+    for (int i = a->first; i < a->first + a->count; i++)
+    {
+        if (a->fds[i] == -1)
+            continue;
+        WireReader reader;
+        WireMessage msg;
+        wire_reader_init(&reader);
+        while (wire_recv(&reader, a->fds[i], &msg) == 1)
+        {
+            if (msg.type == WIRE_WELCOME && msg.session != WIRE_LOBBY_SESSION)
+            {
+                a->samples[i] = msg.timestamp_ns - a->connect_ns[i];
+                break;
+            }
+        }
+    }
+    return NULL;
+}
+
+// 자식 프로세스: sock_server (max_games 판이 끝나면 종료), ready 에 한 바이트를 쓰면 준비 완료
+static pid_t start_server(const char *path, long max_games, int ready)
+{
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid != 0)
+        return pid;
+    // 한꺼번에 끊긴 클라이언트에 보내다 실패하는 로그도 버림
+    int devnull = open("/dev/null", O_WRONLY);
+    dup2(devnull, STDOUT_FILENO);
+    dup2(devnull, STDERR_FILENO);
+    close(devnull);
+    bench_raise_fd_limit();
+    signal(SIGPIPE, SIG_IGN);
+    SockConfig config;
+    sock_config_default(&config);
+    config.path = path;
+    config.max_games = max_games;
+    config.verbose = 0;
+    SockServer server;
+    if (sock_server_init(&server, &config) == -1 || write(ready, "r", 1) != 1)
+        _exit(EXIT_FAILURE);
+    int rc = sock_server_run(&server);
+    sock_server_destroy(&server);
+    _exit(rc == 0 ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+// 서버를 띄우고 접속을 받을 준비가 될 때까지 기다림 (실패하면 -1)
+static pid_t launch_server(const char *path, long max_games)
+{
+    int ready[2];
+    char byte;
+    if (pipe(ready) == -1)
+    {
+        perror("pipe failed");
+        return -1;
+    }
+    pid_t pid = start_server(path, max_games, ready[PIPE_WRITE]);
+    close(ready[PIPE_WRITE]);
+    int started = read(ready[PIPE_READ], &byte, 1) == 1;
+    close(ready[PIPE_READ]);
+    if (!started)
+    {
+        fprintf(stderr, "server failed to start\n");
+        waitpid(pid, NULL, 0);
+        return -1;
+    }
+    return pid;
+}
+
+static void burst(const char *path)
+{
+    pid_t pid = launch_server(path, ARRIVALS / 2);
+    if (pid == -1)
+        return;
+
+    int *fds = calloc(ARRIVALS, sizeof(int));
+    uint64_t *connect_ns = calloc(ARRIVALS, sizeof(uint64_t));
+    uint64_t *samples = calloc(ARRIVALS, sizeof(uint64_t));
+    ArrivalArg args[THREADS];
+    pthread_t threads[THREADS];
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, BENCH_STACK_SIZE);
+
+    uint64_t begin = bench_now_ns();
+    for (int t = 0; t < THREADS; t++)
+    {
+        args[t].path = path;
+        args[t].first = ARRIVALS * t / THREADS;
+        args[t].count = ARRIVALS * (t + 1) / THREADS - args[t].first;
+        args[t].fds = fds;
+        args[t].connect_ns = connect_ns;
+        args[t].samples = samples;
+        pthread_create(&threads[t], &attr, arrival_thread, &args[t]);
+    }
+    for (int t = 0; t < THREADS; t++)
+        pthread_join(threads[t], NULL);
+
+    // 마지막으로 짝지어진 시각까지를 폭주 처리 시간으로 봄
+    uint64_t last_match = begin;
+    int matched = 0;
+    for (int i = 0; i < ARRIVALS; i++)
+    {
+        if (samples[i] == 0)
+            continue;
+        matched++;
+        if (connect_ns[i] + samples[i] > last_match)
+            last_match = connect_ns[i] + samples[i];
+    }
+    for (int i = 0; i < ARRIVALS; i++)
+    {
+        if (fds[i] != -1)
+            close(fds[i]); // 서버는 접속 종료로 게임을 끝내고, 모든 게임이 끝나면 종료
+    }
+    waitpid(pid, NULL, 0);
+
+    double span = (double)(last_match - begin) / 1e9;
+    bench_sort(samples, ARRIVALS);
+    uint64_t *matched_samples = samples + (ARRIVALS - matched); // 0(실패)은 정렬 후 앞에 모임
+    printf("%-10s %8d %8d %10.3f %12.0f %10.1f %10.1f %10.1f %10.1f\n", "unix", ARRIVALS, matched, span,
+           matched / 2 / span, bench_percentile(matched_samples, matched, 0.5) / 1e3,
+           bench_percentile(matched_samples, matched, 0.99) / 1e3,
+           bench_percentile(matched_samples, matched, 0.999) / 1e3,
+           bench_percentile(matched_samples, matched, 1.0) / 1e3);
+    fflush(stdout);
+    free(fds);
+    free(connect_ns);
+    free(samples);
+}
+
+// type 메시지가 올 때까지 읽음 (WIRE_WELCOME 은 대기열 입장 알림을 건너뛰고 짝지어진 알림만)
+static int lobby_expect(LobbyPlayer *p, int type, WireMessage *msg)
+{
+    while (wire_recv(&p->reader, p->fd, msg) == 1)
+    {
+        if (msg->type == type && (type != WIRE_WELCOME || msg->session != WIRE_LOBBY_SESSION))
+            return 0;
+    }
+    return -1;
+}
+
+// 짝지어진 두 접속으로 무승부 순서를 끝까지 둠, 반환: 두 접속이 짝지어진 시각 (실패: 0)
+static uint64_t requeue_game(LobbyPlayer conn[MAX_CLIENTS])
+{
+    LobbyPlayer *by_player[MAX_CLIENTS] = {NULL, NULL};
+    uint64_t matched_ns = 0;
+    WireMessage msg;
+    for (int c = 0; c < MAX_CLIENTS; c++)
+    {
+        if (lobby_expect(&conn[c], WIRE_WELCOME, &msg) == -1 || msg.player < 0 || msg.player >= MAX_CLIENTS)
+            return 0;
+        by_player[msg.player] = &conn[c];
+        if (msg.timestamp_ns > matched_ns)
+            matched_ns = msg.timestamp_ns;
+    }
+    if (by_player[0] == NULL || by_player[1] == NULL)
+        return 0;
+    for (int i = 0; i < 9; i++)
+    {
+        LobbyPlayer *p = by_player[i % 2];
+        if (lobby_expect(p, WIRE_YOUR_TURN, &msg) == -1)
+            return 0;
+        WireMessage move = {.type = WIRE_MOVE, .session = msg.session, .player = i % 2,
+                            .row = bench_draw_script[i] / TTT_SIDE, .col = bench_draw_script[i] % TTT_SIDE};
+        move.timestamp_ns = wire_now_ns();
+        if (wire_send(p->fd, &move) == -1)
+            return 0;
+    }
+    for (int c = 0; c < MAX_CLIENTS; c++)
+    {
+        if (lobby_expect(&conn[c], WIRE_GAME_OVER, &msg) == -1)
+            return 0;
+    }
+    return matched_ns;
+}
+
+// 같은 두 접속이 게임을 마칠 때마다 WIRE_REQUEUE 로 다시 대기열에 들어가 짝지어지는지 확인
+static int requeue(const char *path)
+{
+    pid_t pid = launch_server(path, REQUEUE_ROUNDS);
+    if (pid == -1)
+        return -1;
+    struct sockaddr_un addr = {.sun_family = AF_UNIX};
+    snprintf(addr.sun_path, sizeof(addr.sun_path), "%s", path);
+    LobbyPlayer conn[MAX_CLIENTS];
+    for (int c = 0; c < MAX_CLIENTS; c++)
+    {
+        conn[c].fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (conn[c].fd != -1 && connect(conn[c].fd, (struct sockaddr *)&addr, sizeof(addr)) == -1)
+        {
+            close(conn[c].fd);
+            conn[c].fd = -1;
+        }
+        wire_reader_init(&conn[c].reader);
+    }
+
+    uint64_t *samples = calloc(REQUEUE_ROUNDS, sizeof(uint64_t));
+    int rounds = 0;
+    uint64_t begin = bench_now_ns();
+    if (conn[0].fd != -1 && conn[1].fd != -1 && requeue_game(conn) != 0)
+        rounds++;
+    while (rounds > 0 && rounds < REQUEUE_ROUNDS)
+    {
+        uint64_t start = bench_now_ns();
+        int sent = 1;
+        for (int c = 0; c < MAX_CLIENTS; c++)
+        {
+            WireMessage again = {.type = WIRE_REQUEUE};
+            again.timestamp_ns = wire_now_ns();
+            sent &= wire_send(conn[c].fd, &again) == 0;
+        }
+        uint64_t matched_ns = sent ? requeue_game(conn) : 0;
+        if (matched_ns == 0)
+            break;
+        samples[rounds - 1] = matched_ns - start;
+        rounds++;
+    }
+    double span = (double)(bench_now_ns() - begin) / 1e9;
+    for (int c = 0; c < MAX_CLIENTS; c++)
+    {
+        if (conn[c].fd != -1)
+            close(conn[c].fd);
+    }
+    if (rounds < REQUEUE_ROUNDS)
+        kill(pid, SIGTERM); // 짝지어지지 않아 서버가 남은 판을 기다리는 중
+    waitpid(pid, NULL, 0);
+
+    int requeued = rounds > 0 ? rounds - 1 : 0;
+    bench_sort(samples, requeued);
+    printf("%-10s %8d %8d %10.3f %12.0f %10.1f %10.1f %10.1f\n", "unix", REQUEUE_ROUNDS, rounds, span, rounds / span,
+           bench_percentile(samples, requeued, 0.5) / 1e3, bench_percentile(samples, requeued, 0.99) / 1e3,
+           bench_percentile(samples, requeued, 1.0) / 1e3);
+    fflush(stdout);
+    free(samples);
+    if (rounds < REQUEUE_ROUNDS)
+    {
+        fprintf(stderr, "requeued players were not paired again after %d games\n", rounds);
+        return -1;
+    }
+    return 0;
+}
+
+int main(void)
+{
+    bench_raise_fd_limit();
+    signal(SIGPIPE, SIG_IGN);
+
+    printf("lobby queue operation cost (insert / remove / pair, %d iterations)\n", OPS);
+    printf("%10s %10s\n", "waiting", "ns/op");
+    static const int depths[] = {16, 1000, 10000, 100000};
+    for (size_t d = 0; d < sizeof(depths) / sizeof(depths[0]); d++)
+        printf("%10d %10.1f\n", depths[d], queue_ops(depths[d]));
+
+    char dir[] = "/tmp/ttt_lobby_XXXXXX";
+    if (mkdtemp(dir) == NULL)
+    {
+        perror("mkdtemp failed");
+        return 1;
+    }
+    char path[SESSION_PATH_MAX];
+    snprintf(path, sizeof(path), "%s/lobby.sock", dir);
+
+    printf("\ntime to match, burst of %d arrivals from %d threads (%ld CPUs)\n", ARRIVALS, THREADS,
+           sysconf(_SC_NPROCESSORS_ONLN));
+    printf("%-10s %8s %8s %10s %12s %10s %10s %10s %10s\n", "server", "arrivals", "matched", "burst s",
+           "matches/sec", "p50 us", "p99 us", "p99.9 us", "max us");
+    burst(path);
+
+    printf("\nrequeue after game over, same two connections for %d games\n", REQUEUE_ROUNDS);
+    printf("%-10s %8s %8s %10s %12s %10s %10s %10s\n", "server", "games", "played", "seconds", "games/sec",
+           "p50 us", "p99 us", "max us");
+    int rc = requeue(path);
+
+    unlink(path);
+    rmdir(dir);
+    return rc == 0 ? 0 : 1;
+}
@@ -0,0 +1,116 @@
+// bench_mnk.c
+// m×n k목 게임판에서 수 하나당 승리 판정 비용 측정
+//  last-move : 마지막 수를 지나는 네 줄만 확인 (mnk_wins_at, O(k))
+//  full-scan : 수마다 게임판 전체를 훑는 기존 check_winner 방식 (O(m·n·k))
+#include <stdio.h>
+#include <stdlib.h>
+#include "mnk_board.h"
+#include "bench_util.h"
+
+#define GAMES 200
+
+// 게임판 전체에서 k목이 완성된 줄이 있는지 확인 (기존 방식의 일반화)
+static int full_scan_winner(const MnkBoard *board)
+{
+    static const int dirs[4][2] = {{0, 1}, {1, 0}, {1, 1}, {1, -1}};
+    for (int r = 0; r < board->rows; r++)
+    {
+        for (int c = 0; c < board->cols; c++)
+        {
+            int player = mnk_cell(board, r, c);
+            if (player == MNK_EMPTY)
+                continue;
+            for (int d = 0; d < 4; d++)
+            {
+                int i = 1;
+                for (; i < board->k; i++)
+                {
+                    int rr = r + dirs[d][0] * i, cc = c + dirs[d][1] * i;
+                    if (rr < 0 || rr >= board->rows || cc < 0 || cc >= board->cols ||
+                        mnk_cell(board, rr, cc) != player)
+                        break;
+                }
+                if (i == board->k)
+                    return player;
+            }
+        }
+    }
+    return -1;
+}
+
+// 무작위 순서로 칸을 채우며 승부가 날 때까지 진행, 둔 수의 개수 반환
+static long play_games(int side, int k, const int *orders, int full_scan, long *sink)
+{
+    MnkBoard board;
+    mnk_init(&board, side, side, k);
+    int cells = side * side;
+    long moves = 0;
+    for (int g = 0; g < GAMES; g++)
+    {
+        mnk_reset(&board);
+        const int *order = &orders[g * cells];
+        for (int i = 0; i < cells; i++)
+        {
+            int row = order[i] / side, col = order[i] % side;
+            mnk_place(&board, i % 2, row, col);
+            moves++;
+            int won = full_scan ? full_scan_winner(&board) != -1 : mnk_wins_at(&board, row, col);
+            if (won)
+            {
+                *sink += i;
+                break;
+            }
+        }
+    }
+    return moves;
+}
+
+int main(void)
+{
+    static const int sides[] = {7, 9, 11, 13, 15, 17, 19};
+    const int k = 5;
+    long sink = 0;
+    srand(2024);
+
+    printf("k=%d, %d random games per board\n", k, GAMES);
+    printf("%7s  %10s  %16s  %16s\n", "board", "moves", "last-move ns/mv", "full-scan ns/mv");
+    for (size_t s = 0; s < sizeof(sides) / sizeof(sides[0]); s++)
+    {
+        int side = sides[s];
+        int cells = side * side;
+
+        // 게임마다 칸을 섞은 순서를 미리 생성 (난수 비용 제외)
+        int *orders = malloc(sizeof(int) * cells * GAMES);
+        for (int g = 0; g < GAMES; g++)
+        {
+            int *order = &orders[g * cells];
+            for (int i = 0; i < cells; i++)
+                order[i] = i;
+            for (int i = cells - 1; i > 0; i--)
+            {
+                int j = rand() % (i + 1), t = order[i];
+                order[i] = order[j];
+                order[j] = t;
+            }
+        }
+
+        // 증분 판정은 짧아서 여러 번 반복하여 측정
+        const int repeat = 50;
+        uint64_t start = bench_now_ns();
+        long moves = 0;
+        for (int r = 0; r < repeat; r++)
+            moves += play_games(side, k, orders, 0, &sink);
+        double incremental = (double)(bench_now_ns() - start) / moves;
+
+        start = bench_now_ns();
+        long scanned = play_games(side, k, orders, 1, &sink);
+        double full = (double)(bench_now_ns() - start) / scanned;
+
+        char label[16];
+        snprintf(label, sizeof(label), "%dx%d", side, side);
+        printf("%7s  %10ld  %16.1f  %16.1f\n", label, scanned, incremental, full);
+        free(orders);
+    }
+    printf("(checksum %ld)\n", sink);
+    return 0;
+}
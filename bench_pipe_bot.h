@@ -0,0 +1,80 @@
+// bench_pipe_bot.h
+// 벤치마크용 FIFO 봇 클라이언트 도우미 (pipe_client.c와 같은 프로토콜)
+#ifndef BENCH_PIPE_BOT_H
+#define BENCH_PIPE_BOT_H
+
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "pipe_session.h"
+
+typedef struct
+{
+    int to_server;   // 클라이언트 -> 서버 FIFO
+    int from_server; // 서버 -> 클라이언트 FIFO
+    int session_id;
+    int player_id;
+    WireReader reader;
+} BenchBotConn;
+
+// 세션의 플레이어 FIFO 열기 (서버 세션 스레드와 같은 순서: 쓰기 후 읽기)
+static inline int bench_bot_open(BenchBotConn *conn, const char *dir, int session_id, int player_id)
+{
+    char name[SESSION_PATH_MAX];
+    snprintf(name, sizeof(name), CLIENT_FIFO_FORMAT, dir, session_id, player_id);
+    conn->to_server = open(name, O_WRONLY);
+    snprintf(name, sizeof(name), SERVER_FIFO_FORMAT, dir, session_id, player_id);
+    conn->from_server = open(name, O_RDONLY);
+    conn->session_id = session_id;
+    conn->player_id = player_id;
+    wire_reader_init(&conn->reader);
+    if (conn->to_server == -1 || conn->from_server == -1)
+    {
+        perror("bot open failed");
+        return -1;
+    }
+    return 0;
+}
+
+static inline void bench_bot_close(BenchBotConn *conn)
+{
+    close(conn->to_server);
+    close(conn->from_server);
+}
+
+// type 메시지가 올 때까지 대기 (다른 메시지는 건너뜀)
+static inline int bench_bot_wait(BenchBotConn *conn, int type)
+{
+    WireMessage msg;
+    for (;;)
+    {
+        if (wire_recv(&conn->reader, conn->from_server, &msg) != 1)
+            return -1;
+        if (msg.type == type)
+            return 0;
+    }
+}
+
+// 다음 메시지 하나 수신 (1: 메시지, 그 외: 연결 종료 또는 오류)
+static inline int bench_bot_recv(BenchBotConn *conn, WireMessage *msg)
+{
+    return wire_recv(&conn->reader, conn->from_server, msg);
+}
+
+// (row, col)에 수 전송
+static inline int bench_bot_move_at(BenchBotConn *conn, int row, int col)
+{
+    WireMessage msg = {.type = WIRE_MOVE, .session = conn->session_id, .player = conn->player_id,
+                       .row = row, .col = col};
+    msg.timestamp_ns = wire_now_ns();
+    return wire_send(conn->to_server, &msg);
+}
+
+// 셀 번호(0~8)로 수 전송 (3x3 게임판)
+static inline int bench_bot_move(BenchBotConn *conn, int cell)
+{
+    return bench_bot_move_at(conn, cell / TTT_SIDE, cell % TTT_SIDE);
+}
+
+#endif
@@ -0,0 +1,264 @@
+// bench_pool.c
+// 작업 훔치기 작업자 풀의 코어 수 확장성 측정 (작업자 1개부터 CPU 수까지)
+//  tree     : 작업이 자식 작업 둘을 자기 덱에 넣는 분할 정복 (리프는 엔진으로 무작위 게임 진행)
+//             한 작업자의 덱에 쌓인 작업을 다른 작업자가 훔쳐 가야 병렬로 실행됨
+//  sessions : FIFO 세션 SESSIONS 개를 클라이언트마다 스레드(threads) 또는 작업자 풀로 처리
+//             (자식 프로세스의 봇이 세션마다 무승부 스크립트를 둠)
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/wait.h>
+#include "pipe_session.h"
+#include "work_pool.h"
+#include "ttt_engine.h"
+#include "bench_util.h"
+#include "bench_pipe_bot.h"
+
+#define TREE_DEPTH 15     // 리프 2^15 개
+#define LEAF_GAMES 64     // 리프 작업 하나가 두는 무작위 게임 수
+#define SESSIONS 1000
+#define BENCH_STACK_SIZE (64 * 1024)
+
+typedef struct
+{
+    WorkTask task;
+    WorkPool *pool;
+    int depth;
+} TreeNode;
+
+static TreeNode *nodes;        // 완전 이진 트리 (노드 i 의 자식: 2i+1, 2i+2)
+static atomic_long leaves_done;
+static atomic_long checksum;   // 리프 작업이 최적화로 사라지지 않도록
+static pthread_mutex_t done_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t done_cond = PTHREAD_COND_INITIALIZER;
+
+// 리프 작업: 무작위 게임을 끝까지 두고 승자 합계
+static long play_random_games(unsigned seed)
+{
+    long sum = 0;
+    for (int g = 0; g < LEAF_GAMES; g++)
+    {
+        TttBoard board;
+        ttt_init(&board);
+        int player = 0, winner = -1;
+        while (winner == -1 && !ttt_is_full(&board))
+        {
+            int cell = rand_r(&seed) % TTT_CELLS;
+            if (ttt_place(&board, player, cell) == -1)
+                continue;
+            winner = ttt_winner(&board);
+            player = 1 - player;
+        }
+        sum += winner + 1;
+    }
+    return sum;
+}
+
+static void tree_run(WorkTask *task)
+{
+    TreeNode *node = (TreeNode *)task;
+    long index = node - nodes;
+    if (node->depth < TREE_DEPTH)
+    {
+        // 자식 둘을 자기 덱에 넣음 (나중에 넣은 쪽을 먼저 실행, 먼저 넣은 쪽은 훔쳐 가기 좋음)
+        for (int c = 1; c <= 2; c++)
+        {
+            TreeNode *child = &nodes[2 * index + c];
+            child->pool = node->pool;
+            child->depth = node->depth + 1;
+            child->task.run = tree_run;
+            work_pool_submit(node->pool, &child->task);
+        }
+        return;
+    }
+    atomic_fetch_add(&checksum, play_random_games((unsigned)index));
+    if (atomic_fetch_add(&leaves_done, 1) + 1 == (1L << TREE_DEPTH))
+    {
+        pthread_mutex_lock(&done_lock);
+        pthread_cond_signal(&done_cond);
+        pthread_mutex_unlock(&done_lock);
+    }
+}
+
+// 분할 정복 트리 한 번 실행, 리프/초 반환
+static double run_tree(int workers, long *stolen)
+{
+    WorkPool pool;
+    if (work_pool_init(&pool, workers, BENCH_STACK_SIZE) == -1 || work_pool_start(&pool) == -1)
+        return 0;
+    atomic_store(&leaves_done, 0);
+
+    uint64_t start = bench_now_ns();
+    nodes[0].pool = &pool;
+    nodes[0].depth = 0;
+    nodes[0].task.run = tree_run;
+    work_pool_submit(&pool, &nodes[0].task); // 풀 밖에서 넣으므로 주입 대기열로 들어감
+    pthread_mutex_lock(&done_lock);
+    while (atomic_load(&leaves_done) < (1L << TREE_DEPTH))
+        pthread_cond_wait(&done_cond, &done_lock);
+    pthread_mutex_unlock(&done_lock);
+    uint64_t elapsed = bench_now_ns() - start;
+
+    work_pool_stop(&pool);
+    long executed;
+    work_pool_totals(&pool, &executed, stolen);
+    work_pool_destroy(&pool);
+    return (1L << TREE_DEPTH) / (elapsed / 1e9);
+}
+
+typedef struct
+{
+    const char *dir;
+    int session_id;
+} BotArg;
+
+// 세션 하나의 두 플레이어를 모두 두는 봇 스레드
+static void *bot_thread(void *arg)
+{
+    BotArg *bot = (BotArg *)arg;
+    BenchBotConn conn[MAX_CLIENTS];
+    for (int p = 0; p < MAX_CLIENTS; p++)
+    {
+        if (bench_bot_open(&conn[p], bot->dir, bot->session_id, p) == -1)
+            return NULL;
+    }
+    for (int i = 0; i < 9; i++)
+    {
+        int p = i % 2;
+        if (bench_bot_wait(&conn[p], WIRE_YOUR_TURN) == -1 || bench_bot_move(&conn[p], bench_draw_script[i]) == -1)
+            break;
+    }
+    for (int p = 0; p < MAX_CLIENTS; p++)
+    {
+        bench_bot_wait(&conn[p], WIRE_GAME_OVER);
+        bench_bot_close(&conn[p]);
+    }
+    return NULL;
+}
+
+// 자식 프로세스: SESSIONS 개 세션의 클라이언트 역할
+static void run_bots(const char *dir)
+{
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, BENCH_STACK_SIZE);
+    pthread_t *threads = calloc(SESSIONS, sizeof(pthread_t));
+    BotArg *args = calloc(SESSIONS, sizeof(BotArg));
+    for (int s = 0; s < SESSIONS; s++)
+    {
+        args[s].dir = dir;
+        args[s].session_id = s;
+        if (pthread_create(&threads[s], &attr, bot_thread, &args[s]) != 0)
+        {
+            perror("bot pthread_create failed");
+            _exit(EXIT_FAILURE);
+        }
+    }
+    for (int s = 0; s < SESSIONS; s++)
+        pthread_join(threads[s], NULL);
+    _exit(EXIT_SUCCESS);
+}
+
+// 세션 테이블 한 번 실행 (workers 0: 클라이언트마다 스레드), 초당 수 반환
+static double run_sessions(int workers, int *finished)
+{
+    char dir[] = "/tmp/ttt_pool_XXXXXX";
+    if (mkdtemp(dir) == NULL)
+    {
+        perror("mkdtemp failed");
+        return 0;
+    }
+    SessionConfig config;
+    session_config_default(&config);
+    config.count = SESSIONS;
+    config.dir = dir;
+    config.verbose = 0;
+    config.stack_size = BENCH_STACK_SIZE;
+    config.workers = workers;
+    SessionTable table;
+    if (session_table_init(&table, &config) == -1)
+    {
+        session_table_destroy(&table);
+        rmdir(dir);
+        return 0;
+    }
+
+    // 게임 규칙의 콘솔 출력은 측정 중에 버림
+    fflush(stdout);
+    int saved_stdout = dup(STDOUT_FILENO);
+    int devnull = open("/dev/null", O_WRONLY);
+    dup2(devnull, STDOUT_FILENO);
+    close(devnull);
+
+    uint64_t start = bench_now_ns();
+    pid_t pid = fork();
+    if (pid == 0)
+        run_bots(dir);
+    if (session_table_start(&table) == 0)
+        session_table_join(&table);
+    uint64_t elapsed = bench_now_ns() - start;
+    waitpid(pid, NULL, 0);
+
+    fflush(stdout);
+    dup2(saved_stdout, STDOUT_FILENO);
+    close(saved_stdout);
+
+    long moves = 0;
+    *finished = 0;
+    for (int s = 0; s < table.count; s++)
+    {
+        moves += table.sessions[s].moves;
+        *finished += table.sessions[s].game_over_flag;
+    }
+    session_table_destroy(&table);
+    rmdir(dir);
+    return moves / (elapsed / 1e9);
+}
+
+int main(int argc, char *argv[])
+{
+    bench_raise_fd_limit();
+    int cpus = work_pool_cpus();
+    int max_workers = argc > 1 ? atoi(argv[1]) : cpus; // 인자로 CPU 수보다 많은 작업자도 측정 가능
+    if (max_workers <= 0)
+        max_workers = cpus;
+    int counts[32], n = 0;
+    for (int w = 1; w < max_workers && n < 31; w *= 2)
+        counts[n++] = w;
+    counts[n++] = max_workers;
+
+    nodes = calloc((2L << TREE_DEPTH) - 1, sizeof(TreeNode));
+    printf("fork-join tree, %ld leaves x %d random games (%d CPUs)\n", 1L << TREE_DEPTH, LEAF_GAMES, cpus);
+    printf("%8s %12s %10s %10s\n", "workers", "leaves/sec", "speedup", "stolen");
+    double base = 0;
+    for (int i = 0; i < n; i++)
+    {
+        long stolen;
+        double rate = run_tree(counts[i], &stolen);
+        if (i == 0)
+            base = rate;
+        printf("%8d %12.0f %10.2f %10ld\n", counts[i], rate, rate / base, stolen);
+        fflush(stdout);
+    }
+    free(nodes);
+
+    printf("\nfifo sessions, %d games (draw script)\n", SESSIONS);
+    printf("%-8s %8s %10s %12s %10s\n", "server", "threads", "finished", "moves/sec", "speedup");
+    int finished;
+    // 스레드 모드: 메인 + 세션 스레드 + 클라이언트 핸들러 2개씩 (모든 세션이 진행 중일 때)
+    double rate = run_sessions(0, &finished);
+    printf("%-8s %8d %10d %12.0f %10s\n", "threads", 1 + 3 * SESSIONS, finished, rate, "-");
+    fflush(stdout);
+    for (int i = 0; i < n; i++)
+    {
+        // 풀 모드: 메인 + 이벤트 대기 스레드 + 작업자
+        rate = run_sessions(counts[i], &finished);
+        if (i == 0)
+            base = rate;
+        printf("pool %-3d %8d %10d %12.0f %10.2f\n", counts[i], 2 + counts[i], finished, rate, rate / base);
+        fflush(stdout);
+    }
+    return 0;
+}
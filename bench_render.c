@@ -0,0 +1,113 @@
+// bench_render.c
+// 게임판 화면 갱신 비용 비교 (출력은 /dev/null)
+//  clear+print : 기존 방식 (system("clear") 후 게임판 전체를 printf, 매초 변화와 무관하게 반복)
+//  incremental : term_render (세대가 바뀔 때만, 바뀐 칸과 상태 줄만 ANSI 커서 이동으로 덮어씀)
+#include <stdio.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "term_render.h"
+#include "bench_util.h"
+
+#define OLD_GAMES 5
+#define NEW_GAMES 20000
+
+// 기존 print_board 와 같은 출력, 출력한 바이트 수 반환
+static long print_board(const TttBoard* board) {
+    long bytes = printf("\n");
+    for (int i = 0; i < TTT_CELLS; i++) {
+        bytes += printf(" %c ", ttt_cell_char(board, i));
+        if ((i + 1) % 3 == 0) {
+            bytes += printf("\n");
+            if (i < 6) bytes += printf("---+---+---\n");
+        }
+        else {
+            bytes += printf("|");
+        }
+    }
+    return bytes + printf("\n");
+}
+
+// clear 명령이 출력하는 바이트 수
+static long clear_bytes(void) {
+    FILE* fp = popen("clear", "r");
+    long bytes = 0;
+    if (fp == NULL) {
+        return 0;
+    }
+    while (fgetc(fp) != EOF) {
+        bytes++;
+    }
+    pclose(fp);
+    return bytes;
+}
+
+// 9수 무승부 게임 한 판을 그리며 출력한 바이트 수 반환
+static long play_old(long clear_len) {
+    TttBoard board;
+    ttt_init(&board);
+    long bytes = 0;
+    for (int i = 0; i < TTT_CELLS; i++) {
+        ttt_place(&board, i % 2, bench_draw_script[i]);
+        if (system("clear") == -1) {
+            perror("system failed");
+        }
+        bytes += clear_len + printf("틱택토 게임 서버\n");
+        bytes += print_board(&board);
+        fflush(stdout);
+    }
+    return bytes;
+}
+
+static long play_new(void) {
+    TermRender render;
+    term_render_init(&render);
+    TttBoard board;
+    ttt_init(&board);
+    long bytes = term_render_update(&render, 0, &board, "틱택토 게임 서버");
+    for (int i = 0; i < TTT_CELLS; i++) {
+        ttt_place(&board, i % 2, bench_draw_script[i]);
+        bytes += term_render_update(&render, (uint32_t)i + 1, &board, i % 2 ? "플레이어 0의 차례" : "플레이어 1의 차례");
+    }
+    // 세대가 그대로면 아무것도 출력하지 않음
+    bytes += term_render_update(&render, TTT_CELLS, &board, "플레이어 0의 차례");
+    term_render_destroy(&render);
+    return bytes;
+}
+
+int main(void) {
+    if (getenv("TERM") == NULL) {
+        setenv("TERM", "xterm", 1);
+    }
+    long clear_len = clear_bytes();
+    fflush(stdout);
+    int saved_stdout = dup(STDOUT_FILENO);
+    int devnull = open("/dev/null", O_WRONLY);
+    dup2(devnull, STDOUT_FILENO);
+    close(devnull);
+
+    uint64_t start = bench_now_ns();
+    long old_bytes = 0;
+    for (int g = 0; g < OLD_GAMES; g++) {
+        old_bytes += play_old(clear_len);
+    }
+    double old_ns = (double)(bench_now_ns() - start) / (OLD_GAMES * TTT_CELLS);
+
+    start = bench_now_ns();
+    long new_bytes = 0;
+    for (int g = 0; g < NEW_GAMES; g++) {
+        new_bytes += play_new();
+    }
+    double new_ns = (double)(bench_now_ns() - start) / (NEW_GAMES * TTT_CELLS);
+
+    fflush(stdout);
+    dup2(saved_stdout, STDOUT_FILENO);
+    close(saved_stdout);
+
+    printf("redraw cost per move (9-move game, output to /dev/null)\n");
+    printf("%-12s %12s  %12s  %14s\n", "renderer", "us/frame", "bytes/frame", "forks/frame");
+    printf("%-12s %12.2f  %12.1f  %14d\n", "clear+print", old_ns / 1e3, (double)old_bytes / (OLD_GAMES * TTT_CELLS), 2);
+    printf("%-12s %12.2f  %12.1f  %14d\n", "incremental", new_ns / 1e3, (double)new_bytes / (NEW_GAMES * TTT_CELLS), 0);
+    printf("idle frames/sec: clear+print 1 (redraws every second), incremental 0\n");
+    return 0;
+}
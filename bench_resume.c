@@ -0,0 +1,219 @@
+// bench_resume.c
+// 상태 파일로 재시작할 때 진행 중인 세션을 되살리는 시간 측정 (기본 100000 세션, 3x3)
+//  save    : 수마다 호출하는 state_save 비용 (mmap 한 파일에 복사 + 체크섬, 시스템 호출 없음)
+//  load    : 다시 켠 서버가 파일을 열고 모든 세션의 복사본 둘을 검증해 최신 상태를 고르는 시간
+//  init    : session_table_init 전체 (세션 준비, FIFO 생성) 를 상태 파일 없이 / 있이 실행한 시간
+//            FIFO 생성 시간이 흔들리므로 번갈아 INIT_ROUNDS 번씩 실행해 가장 짧은 값을 비교
+//            세션마다 FIFO 네 개를 만들어 오래 걸리므로 앞의 INIT_SESSIONS 세션만 사용
+//            둘의 차이가 재시작 때문에 더해지는 시간
+//  torn    : 최신 복사본을 일부러 망가뜨린 세션은 직전 상태로 되살아나는지 확인
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <dirent.h>
+#include "pipe_session.h"
+#include "bench_util.h"
+
+#define DEFAULT_SESSIONS 100000
+#define TORN_EVERY 100 // 이 간격마다 한 세션의 최신 복사본을 망가뜨림
+#define INIT_ROUNDS 3
+#define INIT_SESSIONS 1000
+
+static char dir[] = "/tmp/ttt_resume_XXXXXX";
+static char path[512];
+
+// 세션마다 끝나지 않은 게임 하나를 두며 수마다 저장 (서버의 session_commit 과 같은 내용)
+static uint64_t write_sessions(int count, int *moves_out)
+{
+    StateFile file;
+    if (state_open(&file, path, "bench_resume", count, 3, 3, 3) != 0)
+        exit(EXIT_FAILURE);
+    uint64_t saves = 0, total_ns = 0;
+    srand(1);
+    for (int s = 0; s < count; s++)
+    {
+        GameState game;
+        init_game(&game, 3, 3, 3);
+        StateSnapshot snapshot = {.winner = -1, .connected = {1, 1}, .last_row = -1, .last_col = -1};
+        int moves = 2 + s % 3; // 2~4수: 3x3 에서는 아직 승부가 나지 않음
+        for (int m = 0; m < moves; m++)
+        {
+            int cell;
+            do
+                cell = rand() % 9;
+            while (mnk_cell(&game.board, cell / 3, cell % 3) != MNK_EMPTY);
+            make_move(&game, game.turn, cell / 3, cell % 3);
+            game.winner = check_result(&game);
+            if (game.winner == -1)
+                game.turn = 1 - game.turn;
+
+            snapshot.turn = game.turn;
+            snapshot.winner = game.winner;
+            snapshot.over = game.winner != -1;
+            snapshot.last_row = game.last_row;
+            snapshot.last_col = game.last_col;
+            snapshot.moves = m + 1;
+            memcpy(snapshot.cells, game.board.cells, 9);
+            uint64_t start = bench_now_ns();
+            state_save(&file, s, &snapshot);
+            total_ns += bench_now_ns() - start;
+            saves++;
+            if (game.winner != -1)
+                break;
+        }
+        moves_out[s] = snapshot.moves;
+    }
+    state_close(&file);
+    printf("%-8s %10lu saves  %8.1f ns/save\n", "save", (unsigned long)saves, (double)total_ns / saves);
+    return saves;
+}
+
+// 최신 복사본의 한 바이트를 바꿔 체크섬이 맞지 않게 함 (쓰는 도중에 죽은 것과 같음)
+static int tear_sessions(int count)
+{
+    FILE *f = fopen(path, "r+b");
+    if (f == NULL)
+    {
+        perror("fopen");
+        exit(EXIT_FAILURE);
+    }
+    StateHeader header;
+    if (fread(&header, sizeof(header), 1, f) != 1)
+        exit(EXIT_FAILURE);
+    int torn = 0;
+    for (int s = 0; s < count; s += TORN_EVERY)
+    {
+        // 두 복사본 중 seq 가 큰 쪽의 마지막 칸 바이트를 바꿈
+        long base = STATE_HEADER_SIZE + (long)s * 2 * header.slot_size;
+        uint32_t seq[2];
+        for (int c = 0; c < 2; c++)
+        {
+            fseek(f, base + c * (long)header.slot_size + (long)offsetof(StateSlot, seq), SEEK_SET);
+            if (fread(&seq[c], sizeof(uint32_t), 1, f) != 1)
+                exit(EXIT_FAILURE);
+        }
+        int newest = seq[1] > seq[0];
+        fseek(f, base + newest * (long)header.slot_size + (long)offsetof(StateSlot, cells) + 8, SEEK_SET);
+        fputc(0x7f, f);
+        torn++;
+    }
+    fclose(f);
+    return torn;
+}
+
+static void run_load(int count, const int *moves, int torn)
+{
+    uint64_t start = bench_now_ns();
+    StateFile file;
+    if (state_open(&file, path, "bench_resume", count, 3, 3, 3) != 1)
+        exit(EXIT_FAILURE);
+    uint64_t opened = bench_now_ns();
+    int live = 0, fell_back = 0;
+    for (int s = 0; s < count; s++)
+    {
+        StateSnapshot snapshot;
+        if (state_load(&file, s, &snapshot) == -1)
+            continue;
+        live += !snapshot.over;
+        fell_back += snapshot.moves == moves[s] - 1;
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+    state_close(&file);
+    printf("%-8s %10d live  %8.3f ms (open+map %.3f ms), %d of %d torn sessions fell back one move\n", "load", live,
+           elapsed / 1e6, (opened - start) / 1e6, fell_back, torn);
+}
+
+// FIFO 디렉터리 비우기 (session_table_destroy 가 FIFO 를 지우지만 실패한 경우를 대비)
+static void clear_dir(void)
+{
+    DIR *d = opendir(dir);
+    if (d == NULL)
+        return;
+    struct dirent *entry;
+    char name[600];
+    while ((entry = readdir(d)) != NULL)
+    {
+        if (entry->d_name[0] == '.' || strcmp(entry->d_name, "state") == 0)
+            continue;
+        snprintf(name, sizeof(name), "%s/%s", dir, entry->d_name);
+        unlink(name);
+    }
+    closedir(d);
+}
+
+static uint64_t run_init(int count, int sessions, int with_state, int *resumed)
+{
+    StateFile file;
+    SessionConfig config;
+    session_config_default(&config);
+    config.count = sessions; // 상태 파일은 전체 세션 수로 열고 앞쪽 세션만 이어 둠
+    config.dir = dir;
+    config.verbose = 0;
+    config.workers = 0;
+
+    uint64_t start = bench_now_ns();
+    if (with_state)
+    {
+        if (state_open(&file, path, "bench_resume", count, 3, 3, 3) != 1)
+            exit(EXIT_FAILURE);
+        config.state = &file;
+    }
+    SessionTable table;
+    int rc = session_table_init(&table, &config);
+    uint64_t elapsed = bench_now_ns() - start;
+    if (rc == -1)
+    {
+        fprintf(stderr, "session_table_init failed\n");
+        exit(EXIT_FAILURE);
+    }
+    *resumed = table.resumed;
+    session_table_destroy(&table);
+    if (with_state)
+        state_close(&file);
+    clear_dir();
+    return elapsed;
+}
+
+static void compare_init(int count)
+{
+    int sessions = count < INIT_SESSIONS ? count : INIT_SESSIONS;
+    uint64_t best[2] = {UINT64_MAX, UINT64_MAX};
+    int resumed[2] = {0, 0};
+    for (int round = 0; round < INIT_ROUNDS; round++)
+        for (int with_state = 0; with_state < 2; with_state++)
+        {
+            uint64_t elapsed = run_init(count, sessions, with_state, &resumed[with_state]);
+            if (elapsed < best[with_state])
+                best[with_state] = elapsed;
+        }
+    for (int with_state = 0; with_state < 2; with_state++)
+        printf("%-8s %10d resumed  %8.3f ms (%s, best of %d)\n", "init", resumed[with_state],
+               best[with_state] / 1e6, with_state ? "with state file" : "fresh, no state file", INIT_ROUNDS);
+    fflush(stdout);
+}
+
+int main(int argc, char *argv[])
+{
+    int count = argc > 1 ? atoi(argv[1]) : DEFAULT_SESSIONS;
+    if (count <= 0 || mkdtemp(dir) == NULL)
+    {
+        fprintf(stderr, "Usage: %s [sessions]\n", argv[0]);
+        return 1;
+    }
+    snprintf(path, sizeof(path), "%s/state", dir);
+    int *moves = malloc(sizeof(int) * (size_t)count);
+
+    printf("restart with %d live sessions (3x3), state file %s\n", count, path);
+    write_sessions(count, moves);
+    run_load(count, moves, 0);
+    compare_init(count);
+    int torn = tear_sessions(count);
+    run_load(count, moves, torn);
+
+    free(moves);
+    unlink(path);
+    clear_dir();
+    rmdir(dir);
+    return 0;
+}
@@ -0,0 +1,109 @@
+// bench_search.c
+// 큰 게임판용 병렬 알파-베타(mnk_search)의 스레드 수 확장성 측정 (1개부터 CPU 수까지)
+//  국면마다 치환표를 비우고 같은 시간 예산으로 탐색해서 nodes/sec 와 끝까지 마친 깊이를 비교
+//  tactics : 바로 이기는 수와 막아야 하는 수를 고르는지 확인 (실패하면 종료 코드 1)
+#include <stdio.h>
+#include <stdlib.h>
+#include "mnk_board.h"
+#include "mnk_search.h"
+#include "work_pool.h"
+
+#define DEFAULT_BUDGET_MS 1000
+
+typedef struct
+{
+    const char *name;
+    int rows, cols, k;
+    int stones;          // 처음 둔 수 (X, O 번갈아)
+    int moves[16][2];    // (row, col)
+} BenchPosition;
+
+static const BenchPosition positions[] = {
+    {"7x7 k4 empty", 7, 7, 4, 0, {{0}}},
+    {"15x15 k5 opening", 15, 15, 5, 6, {{7, 7}, {7, 8}, {8, 8}, {6, 6}, {8, 7}, {8, 6}}},
+    {"19x19 k5 middle", 19, 19, 5, 12,
+     {{9, 9}, {9, 10}, {10, 10}, {8, 8}, {10, 9}, {10, 8}, {11, 9}, {8, 9}, {8, 10}, {12, 9}, {11, 11}, {7, 7}}},
+};
+
+static void setup(MnkBoard *board, const BenchPosition *pos)
+{
+    mnk_init(board, pos->rows, pos->cols, pos->k);
+    for (int i = 0; i < pos->stones; i++)
+        mnk_place(board, i % 2, pos->moves[i][0], pos->moves[i][1]);
+}
+
+// X 가 가로 4개를 두고 한쪽이 막힌 15x15 5목: X 차례면 (7, 9)로 이기고, O 차례면 (7, 9)를 막아야 함
+static int check_tactics(int threads)
+{
+    MnkBoard board;
+    mnk_init(&board, 15, 15, 5);
+    for (int col = 5; col < 9; col++)
+        mnk_place(&board, 0, 7, col);
+    mnk_place(&board, 1, 7, 4);
+    mnk_place(&board, 1, 3, 3);
+    mnk_place(&board, 1, 11, 12);
+
+    MnkSearch search;
+    if (mnk_search_init(&search, threads, MNK_SEARCH_TT_BITS) == -1)
+        return -1;
+    int failures = 0;
+    for (int player = 0; player < 2; player++)
+    {
+        MnkSearchResult result;
+        mnk_search_clear(&search);
+        if (mnk_search_best(&search, &board, player, 200, &result) == -1 || result.move != 7 * 15 + 9)
+        {
+            printf("tactics: %s to move chose cell %d, expected (7, 9)\n", player == 0 ? "X" : "O", result.move);
+            failures++;
+        }
+    }
+    mnk_search_destroy(&search);
+    printf("tactics: %s\n", failures == 0 ? "ok (win found, threat blocked)" : "FAILED");
+    return failures;
+}
+
+int main(int argc, char *argv[])
+{
+    int cpus = work_pool_cpus();
+    int max_threads = argc > 1 ? atoi(argv[1]) : cpus; // 인자로 CPU 수보다 많은 스레드도 측정 가능
+    int budget_ms = argc > 2 ? atoi(argv[2]) : DEFAULT_BUDGET_MS;
+    if (max_threads <= 0)
+        max_threads = cpus;
+    if (budget_ms <= 0)
+        budget_ms = DEFAULT_BUDGET_MS;
+    int counts[32], n = 0;
+    for (int t = 1; t < max_threads && n < 31; t *= 2)
+        counts[n++] = t;
+    counts[n++] = max_threads;
+
+    printf("parallel alpha-beta, shared lock-free transposition table, %d ms per search (%d CPUs)\n", budget_ms, cpus);
+    printf("%-18s %8s %6s %12s %12s %10s %8s\n", "position", "threads", "depth", "nodes", "nodes/sec", "speedup",
+           "move");
+    for (size_t p = 0; p < sizeof(positions) / sizeof(positions[0]); p++)
+    {
+        MnkBoard board;
+        setup(&board, &positions[p]);
+        int player = positions[p].stones % 2;
+        double base = 0;
+        for (int i = 0; i < n; i++)
+        {
+            MnkSearch search;
+            MnkSearchResult result;
+            if (mnk_search_init(&search, counts[i], MNK_SEARCH_TT_BITS) == -1 ||
+                mnk_search_best(&search, &board, player, budget_ms, &result) == -1)
+            {
+                fprintf(stderr, "search failed\n");
+                return 1;
+            }
+            double rate = result.nodes / (result.elapsed_ns / 1e9);
+            if (i == 0)
+                base = rate;
+            printf("%-18s %8d %6d %12lu %12.0f %10.2f  (%d, %d)\n", positions[p].name, counts[i], result.depth,
+                   (unsigned long)result.nodes, rate, rate / base, result.move / board.cols, result.move % board.cols);
+            mnk_search_destroy(&search);
+        }
+    }
+
+    printf("\n");
+    return check_tactics(max_threads) == 0 ? 0 : 1;
+}
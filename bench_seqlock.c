@@ -0,0 +1,133 @@
+// bench_seqlock.c
+// 관찰자 수에 따른 수 적용 지연 측정 (관찰자는 게임 상태를 계속 복사)
+//  mutex   : 예전 방식 (관찰자도 뮤텍스를 잡고 복사, 기록자가 관찰자를 기다릴 수 있음)
+//  seqlock : shm_state_snapshot (관찰자는 잠금 없이 복사 후 필요하면 재시도, 기록자는 기다리지 않음)
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "shm_common.h"
+#include "bench_util.h"
+
+#define MOVES 100000
+
+static ShmGame* shm;
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER; // mutex 방식 비교용 (게임 슬롯에는 뮤텍스가 없음)
+static int use_seqlock;
+static _Atomic int stop;
+static _Atomic long snapshots;
+
+// 서버의 apply_command 와 같은 기록 (가득 차거나 승부가 나면 새 판)
+static void apply_move(int cell) {
+    TttBoard next = shm->board;
+    if (ttt_place(&next, shm->turn, cell) == -1) {
+        return;
+    }
+    if (use_seqlock) {
+        shm_seqlock_write_begin(&shm->state_lock);
+    }
+    else {
+        pthread_mutex_lock(&mutex);
+    }
+    shm->board = next;
+    shm->turn = 1 - shm->turn;
+    shm->move_count++;
+    shm->winner = ttt_winner(&shm->board);
+    shm->game_over = shm->winner != -1 || ttt_is_full(&shm->board);
+    if (shm->game_over) {
+        ttt_init(&shm->board);
+        shm->turn = 0;
+        shm->game_over = 0;
+    }
+    if (use_seqlock) {
+        shm_seqlock_write_end(&shm->state_lock);
+    }
+    else {
+        pthread_mutex_unlock(&mutex);
+    }
+}
+
+static void* observer(void* arg) {
+    (void)arg;
+    long count = 0;
+    long sink = 0;
+    while (!atomic_load_explicit(&stop, memory_order_relaxed)) {
+        ShmGameView view;
+        if (use_seqlock) {
+            shm_state_snapshot(shm, &view);
+        }
+        else {
+            pthread_mutex_lock(&mutex);
+            view.board = shm->board;
+            view.turn = shm->turn;
+            view.game_over = shm->game_over;
+            view.winner = shm->winner;
+            view.move_count = shm->move_count;
+            pthread_mutex_unlock(&mutex);
+        }
+        sink += view.move_count + view.board.mask[0];
+        count++;
+    }
+    atomic_fetch_add(&snapshots, count);
+    return (void*)sink;
+}
+
+// 관찰자 readers 개를 띄운 채 수 MOVES 개 적용, 수 하나의 지연 분포 기록
+static double run(int readers, int seqlock, uint64_t* samples) {
+    use_seqlock = seqlock;
+    atomic_store(&stop, 0);
+    atomic_store(&snapshots, 0);
+    shm_seqlock_init(&shm->state_lock);
+    ttt_init(&shm->board);
+    shm->turn = 0;
+    shm->move_count = 0;
+
+    pthread_t* threads = malloc(sizeof(pthread_t) * (readers > 0 ? readers : 1));
+    for (int i = 0; i < readers; i++) {
+        pthread_create(&threads[i], NULL, observer, NULL);
+    }
+
+    uint64_t begin = bench_now_ns();
+    for (int i = 0; i < MOVES; i++) {
+        uint64_t start = bench_now_ns();
+        apply_move(bench_draw_script[i % 9]);
+        samples[i] = bench_now_ns() - start;
+    }
+    double elapsed = (double)(bench_now_ns() - begin);
+
+    atomic_store(&stop, 1);
+    for (int i = 0; i < readers; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    free(threads);
+    bench_sort(samples, MOVES);
+    return atomic_load(&snapshots) / elapsed * 1e9;
+}
+
+int main(void) {
+    static const int reader_counts[] = {0, 1, 2, 4, 8, 16, 32, 64};
+    shm = aligned_alloc(SHM_CACHE_LINE, sizeof(ShmGame));
+    memset(shm, 0, sizeof(ShmGame));
+    uint64_t* samples = malloc(sizeof(uint64_t) * MOVES);
+
+    printf("move apply latency (ns) with observers copying the game state (%ld CPUs)\n",
+           sysconf(_SC_NPROCESSORS_ONLN));
+    printf("%7s  %-7s %6s %6s %6s %9s  %12s\n", "readers", "path", "p50", "p99", "p99.9", "max", "snapshots/s");
+    for (size_t r = 0; r < sizeof(reader_counts) / sizeof(reader_counts[0]); r++) {
+        int readers = reader_counts[r];
+        for (int seqlock = 0; seqlock <= 1; seqlock++) {
+            double rate = run(readers, seqlock, samples);
+            printf("%7d  %-7s %6llu %6llu %6llu %9llu  %12.0f\n", readers, seqlock ? "seqlock" : "mutex",
+                   (unsigned long long)bench_percentile(samples, MOVES, 0.5),
+                   (unsigned long long)bench_percentile(samples, MOVES, 0.99),
+                   (unsigned long long)bench_percentile(samples, MOVES, 0.999),
+                   (unsigned long long)bench_percentile(samples, MOVES, 1.0), rate);
+            fflush(stdout);
+        }
+    }
+
+    free(samples);
+    free(shm);
+    return 0;
+}
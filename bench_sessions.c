@@ -0,0 +1,166 @@
+// bench_sessions.c
+// 한 서버 프로세스가 N개의 세션을 동시에 진행할 때의 처리량 측정
+//  부모 프로세스: 세션 테이블 (서버)
+//  자식 프로세스: 세션마다 스레드 하나가 두 플레이어의 FIFO를 열고 무승부 스크립트를 둠
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/wait.h>
+#include "pipe_session.h"
+#include "bench_util.h"
+#include "bench_pipe_bot.h"
+
+#define BENCH_STACK_SIZE (64 * 1024)
+#define FDS_PER_SESSION 4 // 프로세스당 세션별 FIFO 디스크립터 수
+#define FD_RESERVE 64
+
+typedef struct
+{
+    const char *dir;
+    int session_id;
+} BotArg;
+
+// 세션 하나의 두 플레이어를 모두 두는 봇 스레드
+static void *bot_thread(void *arg)
+{
+    BotArg *bot = (BotArg *)arg;
+    BenchBotConn conn[MAX_CLIENTS];
+
+    for (int p = 0; p < MAX_CLIENTS; p++)
+    {
+        if (bench_bot_open(&conn[p], bot->dir, bot->session_id, p) == -1)
+            return NULL;
+    }
+
+    for (int i = 0; i < 9; i++)
+    {
+        int p = i % 2;
+        if (bench_bot_wait(&conn[p], WIRE_YOUR_TURN) == -1)
+            break;
+        if (bench_bot_move(&conn[p], bench_draw_script[i]) == -1)
+            break;
+    }
+
+    for (int p = 0; p < MAX_CLIENTS; p++)
+    {
+        bench_bot_wait(&conn[p], WIRE_GAME_OVER);
+        bench_bot_close(&conn[p]);
+    }
+    return NULL;
+}
+
+// 자식 프로세스: N개 세션의 클라이언트 역할
+static void run_bots(const char *dir, int count)
+{
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, BENCH_STACK_SIZE);
+    pthread_t *threads = calloc(count, sizeof(pthread_t));
+    BotArg *args = calloc(count, sizeof(BotArg));
+    for (int s = 0; s < count; s++)
+    {
+        args[s].dir = dir;
+        args[s].session_id = s;
+        if (pthread_create(&threads[s], &attr, bot_thread, &args[s]) != 0)
+        {
+            perror("bot pthread_create failed");
+            _exit(EXIT_FAILURE);
+        }
+    }
+    for (int s = 0; s < count; s++)
+        pthread_join(threads[s], NULL);
+    free(threads);
+    free(args);
+    _exit(EXIT_SUCCESS);
+}
+
+static void run_one(int count, long fd_limit)
+{
+    if ((long)count * FDS_PER_SESSION + FD_RESERVE > fd_limit)
+    {
+        printf("%8d  %10s  %10s  %12s  %10s  (skipped: needs %d fds, RLIMIT_NOFILE=%ld)\n",
+               count, "-", "-", "-", "-", count * FDS_PER_SESSION + FD_RESERVE, fd_limit);
+        fflush(stdout);
+        return;
+    }
+
+    char dir[] = "/tmp/ttt_sessions_XXXXXX";
+    if (mkdtemp(dir) == NULL)
+    {
+        perror("mkdtemp failed");
+        return;
+    }
+
+    SessionConfig config;
+    session_config_default(&config);
+    config.count = count;
+    config.dir = dir;
+    config.verbose = 0;
+    config.stack_size = BENCH_STACK_SIZE;
+
+    SessionTable table;
+    if (session_table_init(&table, &config) == -1)
+    {
+        session_table_destroy(&table);
+        rmdir(dir);
+        return;
+    }
+
+    // 게임 규칙의 콘솔 출력은 측정 중에 버림
+    fflush(stdout);
+    int saved_stdout = dup(STDOUT_FILENO);
+    int devnull = open("/dev/null", O_WRONLY);
+    dup2(devnull, STDOUT_FILENO);
+    close(devnull);
+
+    uint64_t start = bench_now_ns();
+    pid_t pid = fork();
+    if (pid == 0)
+        run_bots(dir, count);
+
+    session_table_start(&table);
+    session_table_join(&table);
+    uint64_t elapsed = bench_now_ns() - start;
+    waitpid(pid, NULL, 0);
+
+    fflush(stdout);
+    dup2(saved_stdout, STDOUT_FILENO);
+    close(saved_stdout);
+
+    long moves = 0;
+    int finished = 0;
+    for (int s = 0; s < table.count; s++)
+    {
+        moves += table.sessions[s].moves;
+        finished += table.sessions[s].game_over_flag;
+    }
+    double secs = elapsed / 1e9;
+    printf("%8d  %10d  %10.3f  %12.0f  %10.1f\n", count, finished, secs, moves / secs, finished / secs);
+    fflush(stdout);
+
+    session_table_destroy(&table);
+    rmdir(dir);
+}
+
+int main(int argc, char *argv[])
+{
+    static const int default_counts[] = {1, 10, 100, 1000, 10000};
+    long fd_limit = bench_raise_fd_limit();
+
+    printf("%8s  %10s  %10s  %12s  %10s\n", "sessions", "finished", "wall(s)", "moves/sec", "games/sec");
+    if (argc > 1)
+    {
+        for (int i = 1; i < argc; i++)
+            run_one(atoi(argv[i]), fd_limit);
+    }
+    else
+    {
+        for (size_t i = 0; i < sizeof(default_counts) / sizeof(default_counts[0]); i++)
+            run_one(default_counts[i], fd_limit);
+    }
+    return 0;
+}
@@ -0,0 +1,203 @@
+// bench_shm_ring.c
+// 공유 메모리 수 요청 왕복 지연 측정 (클라이언트 프로세스 -> 서버 프로세스 -> 결과 확인)
+//  mutex+cond : 기존 방식 (공유 뮤텍스를 잡고 게임판 변경 후 broadcast, 서버가 깨어나 확인)
+//  spsc ring  : 명령 링에 넣고 서버가 꺼내 검증/적용 후 ack_seq 로 응답 (잠금 없음, 대기는 backoff)
+//  ring+futex : 같은 링, 대기는 shm_event (shmserver/shmclient 와 같은 방식)
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include "shm_common.h"
+#include "bench_util.h"
+
+#define ROUND_TRIPS 100000
+
+typedef struct {
+    // mutex+cond 경로
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    int requested;     // 클라이언트가 보낸 요청 수
+    int handled;       // 서버가 처리한 요청 수
+    int request_cell;
+    // spsc ring 경로
+    ShmRing ring;
+    _Atomic uint32_t ack_seq;
+    _Atomic int ack_result;
+    _Atomic int stop;
+    ShmEvent command_event;
+    ShmEvent ack_event;
+    // 두 경로 공용: 서버가 적용하는 게임판
+    TttBoard board;
+    int turn;
+} BenchShared;
+
+// 서버 쪽 적용: 빈 칸이면 두고, 가득 차면 새 판 시작
+static int apply_move(BenchShared* shared, int cell) {
+    if (ttt_place(&shared->board, shared->turn, cell) == -1) {
+        return -1;
+    }
+    shared->turn = 1 - shared->turn;
+    if (ttt_winner(&shared->board) != -1 || ttt_is_full(&shared->board)) {
+        ttt_init(&shared->board);
+        shared->turn = 0;
+    }
+    return 0;
+}
+
+static void server_mutex(BenchShared* shared) {
+    pthread_mutex_lock(&shared->mutex);
+    for (;;) {
+        while (shared->requested == shared->handled && !atomic_load(&shared->stop)) {
+            pthread_cond_wait(&shared->cond, &shared->mutex);
+        }
+        if (shared->requested == shared->handled) {
+            break;
+        }
+        apply_move(shared, shared->request_cell);
+        shared->handled = shared->requested;
+        pthread_cond_broadcast(&shared->cond);
+    }
+    pthread_mutex_unlock(&shared->mutex);
+}
+
+static void server_ring(BenchShared* shared, int use_futex) {
+    unsigned spins = 0;
+    while (!atomic_load_explicit(&shared->stop, memory_order_relaxed)) {
+        uint32_t seen = shm_event_prepare(&shared->command_event);
+        ShmCommand cmd;
+        if (!shm_ring_pop(&shared->ring, &cmd)) {
+            if (use_futex) {
+                shm_event_wait(&shared->command_event, seen);
+            }
+            else {
+                shm_backoff(&spins);
+            }
+            continue;
+        }
+        spins = 0;
+        atomic_store_explicit(&shared->ack_result, apply_move(shared, cmd.cell), memory_order_relaxed);
+        atomic_store_explicit(&shared->ack_seq, cmd.seq, memory_order_release);
+        if (use_futex) {
+            shm_event_signal(&shared->ack_event);
+        }
+    }
+}
+
+static void client_mutex(BenchShared* shared, int cell) {
+    pthread_mutex_lock(&shared->mutex);
+    shared->request_cell = cell;
+    int want = ++shared->requested;
+    pthread_cond_broadcast(&shared->cond);
+    while (shared->handled != want) {
+        pthread_cond_wait(&shared->cond, &shared->mutex);
+    }
+    pthread_mutex_unlock(&shared->mutex);
+}
+
+static void client_ring(BenchShared* shared, int cell, uint32_t seq, int use_futex) {
+    ShmCommand cmd = { .cell = cell, .seq = seq, .sent_ns = bench_now_ns() };
+    unsigned spins = 0;
+    while (shm_ring_push(&shared->ring, &cmd) == -1) {
+        shm_backoff(&spins);
+    }
+    if (use_futex) {
+        shm_event_signal(&shared->command_event);
+        for (;;) {
+            uint32_t seen = shm_event_prepare(&shared->ack_event);
+            if (atomic_load_explicit(&shared->ack_seq, memory_order_acquire) == seq) {
+                break;
+            }
+            shm_event_wait(&shared->ack_event, seen);
+        }
+        return;
+    }
+    spins = 0;
+    while (atomic_load_explicit(&shared->ack_seq, memory_order_acquire) != seq) {
+        shm_backoff(&spins);
+    }
+}
+
+// use_ring: 0 mutex+cond, 1 링 + backoff, 2 링 + futex
+static void run(const char* name, BenchShared* shared, int use_ring) {
+    ttt_init(&shared->board);
+    shared->turn = 0;
+    shared->requested = shared->handled = 0;
+    shm_ring_init(&shared->ring);
+    atomic_store(&shared->ack_seq, 0);
+    atomic_store(&shared->stop, 0);
+    shm_event_init(&shared->command_event);
+    shm_event_init(&shared->ack_event);
+
+    pid_t pid = fork();
+    if (pid == 0) {
+        if (use_ring) {
+            server_ring(shared, use_ring == 2);
+        }
+        else {
+            server_mutex(shared);
+        }
+        _exit(0);
+    }
+
+    uint64_t* samples = malloc(sizeof(uint64_t) * ROUND_TRIPS);
+    uint64_t begin = bench_now_ns();
+    for (int i = 0; i < ROUND_TRIPS; i++) {
+        int cell = bench_draw_script[i % 9];
+        uint64_t start = bench_now_ns();
+        if (use_ring) {
+            client_ring(shared, cell, (uint32_t)i + 1, use_ring == 2);
+        }
+        else {
+            client_mutex(shared, cell);
+        }
+        samples[i] = bench_now_ns() - start;
+    }
+    double total = (double)(bench_now_ns() - begin);
+
+    pthread_mutex_lock(&shared->mutex);
+    atomic_store(&shared->stop, 1);
+    pthread_cond_broadcast(&shared->cond);
+    shm_event_signal(&shared->command_event);
+    pthread_mutex_unlock(&shared->mutex);
+    waitpid(pid, NULL, 0);
+
+    bench_sort(samples, ROUND_TRIPS);
+    printf("%-11s %10.2f  %10.2f  %10.2f  %12.0f\n", name,
+           bench_percentile(samples, ROUND_TRIPS, 0.5) / 1e3,
+           bench_percentile(samples, ROUND_TRIPS, 0.99) / 1e3,
+           bench_percentile(samples, ROUND_TRIPS, 0.999) / 1e3,
+           ROUND_TRIPS / total * 1e9);
+    free(samples);
+}
+
+int main(void) {
+    BenchShared* shared = mmap(NULL, sizeof(BenchShared), PROT_READ | PROT_WRITE,
+                               MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (shared == MAP_FAILED) {
+        perror("mmap failed");
+        return 1;
+    }
+
+    pthread_mutexattr_t mutex_attr;
+    pthread_condattr_t cond_attr;
+    pthread_mutexattr_init(&mutex_attr);
+    pthread_mutexattr_setpshared(&mutex_attr, PTHREAD_PROCESS_SHARED);
+    pthread_condattr_init(&cond_attr);
+    pthread_condattr_setpshared(&cond_attr, PTHREAD_PROCESS_SHARED);
+    pthread_mutex_init(&shared->mutex, &mutex_attr);
+    pthread_cond_init(&shared->cond, &cond_attr);
+
+    printf("move request round trip between processes, %d requests (%ld CPUs)\n",
+           ROUND_TRIPS, sysconf(_SC_NPROCESSORS_ONLN));
+    printf("%-11s %10s  %10s  %10s  %12s\n", "path", "p50 us", "p99 us", "p99.9 us", "trips/sec");
+    run("mutex+cond", shared, 0);
+    run("spsc ring", shared, 1);
+    run("ring+futex", shared, 2);
+
+    pthread_mutex_destroy(&shared->mutex);
+    pthread_cond_destroy(&shared->cond);
+    munmap(shared, sizeof(BenchShared));
+    return 0;
+}
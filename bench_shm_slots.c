@@ -0,0 +1,230 @@
+// bench_shm_slots.c
+// 활성 게임 슬롯 수(1~128)에 따른 전체 초당 수 측정: 슬롯마다 플레이어 스레드 하나
+//  서버 쪽은 shmserver 처럼 CPU 마다 관리 스레드 하나가 슬롯을 돌아가며 맡고 doorbell 에서 잠듦
+//  slots  : shmserver 와 같은 경로 (슬롯별 명령 링, 이벤트, seqlock 만 사용, 슬롯끼리 공유하는 잠금 없음)
+//  global : 같은 경로에 모든 슬롯이 함께 잡는 뮤텍스 하나를 수 적용 구간에 더함 (예전 세그먼트의 전역 잠금)
+//  contended: global 뮤텍스를 바로 잡지 못하고 기다린 횟수 (slots 에는 기다릴 잠금이 없음)
+//  전체 수 TOTAL_MOVES 개를 슬롯에 나누어 두므로 슬롯이 늘어도 할 일은 같음, efficiency 는 슬롯 1개 대비
+//  플레이어 스레드는 자리 비트맵에서 자기 슬롯의 두 자리를 차지한 뒤 두 자리를 번갈아 두며 수마다 ack 를 기다림
+//  (bot -t shm 과 같은 왕복)
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "shm_common.h"
+#include "bench_util.h"
+
+#define TOTAL_MOVES 180000
+#define SLOT_STACK (64 * 1024)
+
+typedef struct {
+    ShmGame* game;
+    int slot;
+    int moves; // 이 슬롯에서 둘 수
+    int done;  // 관리 스레드만 씀: 플레이어가 종료 요청을 보냄
+    pthread_t player;
+} Slot;
+
+static SharedMemory* shm;
+static Slot* slot_table;
+static int active_slots;
+static int use_global;
+static pthread_mutex_t global_mutex = PTHREAD_MUTEX_INITIALIZER;
+static _Atomic long contended;
+static pthread_barrier_t start;
+
+// 서버의 apply_command 와 같은 기록 (가득 차거나 승부가 나면 새 판)
+static void apply_move(ShmGame* game, int player, int cell) {
+    TttBoard next = game->board;
+    if (game->turn != player || ttt_place(&next, player, cell) == -1) {
+        return;
+    }
+    if (use_global) {
+        if (pthread_mutex_trylock(&global_mutex) != 0) {
+            atomic_fetch_add_explicit(&contended, 1, memory_order_relaxed);
+            pthread_mutex_lock(&global_mutex);
+        }
+    }
+    shm_seqlock_write_begin(&game->state_lock);
+    game->board = next;
+    game->turn = 1 - player;
+    game->move_count++;
+    game->winner = ttt_winner(&game->board);
+    if (game->winner != -1 || ttt_is_full(&game->board)) {
+        ttt_init(&game->board);
+        game->turn = 0;
+    }
+    shm_seqlock_write_end(&game->state_lock);
+    if (use_global) {
+        pthread_mutex_unlock(&global_mutex);
+    }
+}
+
+// 관리 스레드 하나: 맡은 슬롯들의 명령 링을 비우며 적용하고 보낸 플레이어만 깨움 (칸 -1: 그 슬롯 종료)
+static void* manager_thread(void* arg) {
+    int manager = (int)(intptr_t)arg;
+    ShmEvent* doorbell = &shm->doorbells[manager];
+    for (;;) {
+        uint32_t seen = shm_event_prepare(doorbell);
+        int handled = 0;
+        int open = 0;
+        for (int i = manager; i < active_slots; i += shm->manager_count) {
+            Slot* s = &slot_table[i];
+            ShmGame* game = s->game;
+            for (int p = 0; p < SHM_MAX_CLIENTS && !s->done; p++) {
+                ShmCommand cmd;
+                while (shm_ring_pop(&game->commands[p], &cmd)) {
+                    if (cmd.cell == -1) {
+                        s->done = 1;
+                        break;
+                    }
+                    apply_move(game, p, cmd.cell);
+                    atomic_store_explicit(&game->ack_seq[p], cmd.seq, memory_order_release);
+                    shm_event_signal(&game->player_event[p]);
+                    handled = 1;
+                }
+            }
+            open += !s->done;
+        }
+        if (open == 0) {
+            return NULL;
+        }
+        if (!handled) {
+            shm_event_wait(doorbell, seen);
+        }
+    }
+}
+
+// 슬롯 하나의 두 플레이어: 무승부 순서를 되풀이하며 수마다 ack 까지 기다림
+static void* player_thread(void* arg) {
+    Slot* s = arg;
+    ShmGame* game = s->game;
+    uint64_t mask[SHM_SEAT_WORDS];
+    shm_seat_mask(s->slot, mask);
+    for (int p = 0; p < SHM_MAX_CLIENTS; p++) {
+        if (shm_claim_seat(shm, mask) == -1) {
+            fprintf(stderr, "slot %d: no free seat\n", s->slot);
+            exit(EXIT_FAILURE);
+        }
+    }
+    pthread_barrier_wait(&start);
+
+    uint32_t seq[SHM_MAX_CLIENTS] = { 0 };
+    for (int i = 0; i < s->moves; i++) {
+        int p = (i % 9) % 2;
+        ShmCommand cmd = { .cell = bench_draw_script[i % 9], .seq = ++seq[p] };
+        while (shm_ring_push(&game->commands[p], &cmd) == -1) {
+            sched_yield();
+        }
+        shm_game_notify(shm, game);
+        for (;;) {
+            uint32_t seen = shm_event_prepare(&game->player_event[p]);
+            if (atomic_load_explicit(&game->ack_seq[p], memory_order_acquire) == cmd.seq) {
+                break;
+            }
+            shm_event_wait(&game->player_event[p], seen);
+        }
+    }
+    ShmCommand stop = { .cell = -1 };
+    while (shm_ring_push(&game->commands[0], &stop) == -1) {
+        sched_yield();
+    }
+    shm_game_notify(shm, game);
+    return NULL;
+}
+
+// 슬롯 slots 개로 TOTAL_MOVES 개를 두고 걸린 시간(ns) 반환
+static uint64_t run(int slots, int global) {
+    use_global = global;
+    atomic_store(&contended, 0);
+    memset(shm, 0, sizeof(SharedMemory));
+    shm->game_count = slots;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    shm->manager_count = cpus < 1 ? 1 : cpus < slots ? (int)cpus : slots;
+    for (int m = 0; m < shm->manager_count; m++) {
+        shm_event_init(&shm->doorbells[m]);
+    }
+    for (int i = 0; i < slots; i++) {
+        ShmGame* game = &shm->games[i];
+        shm_seqlock_init(&game->state_lock);
+        ttt_init(&game->board);
+        game->manager = i % shm->manager_count;
+        shm_event_init(&game->board_event);
+        for (int p = 0; p < SHM_MAX_CLIENTS; p++) {
+            int seat = i * SHM_MAX_CLIENTS + p;
+            shm_ring_init(&game->commands[p]);
+            shm_event_init(&game->player_event[p]);
+            atomic_store(&shm->free_seats[seat / 64], atomic_load(&shm->free_seats[seat / 64]) | 1ull << (seat % 64));
+        }
+    }
+    atomic_store_explicit(&shm->magic, SHM_MAGIC, memory_order_release);
+
+    Slot* slot = calloc((size_t)slots, sizeof(Slot));
+    slot_table = slot;
+    active_slots = slots;
+    pthread_t managers[SHM_MAX_GAMES];
+    pthread_barrier_init(&start, NULL, (unsigned)slots + 1);
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, SLOT_STACK);
+    for (int i = 0; i < slots; i++) {
+        slot[i].game = &shm->games[i];
+        slot[i].slot = i;
+        slot[i].moves = TOTAL_MOVES / slots;
+        pthread_create(&slot[i].player, &attr, player_thread, &slot[i]);
+    }
+    for (int m = 0; m < shm->manager_count; m++) {
+        pthread_create(&managers[m], &attr, manager_thread, (void*)(intptr_t)m);
+    }
+    pthread_attr_destroy(&attr);
+    pthread_barrier_wait(&start);
+    uint64_t begin = bench_now_ns();
+    for (int i = 0; i < slots; i++) {
+        pthread_join(slot[i].player, NULL);
+    }
+    for (int m = 0; m < shm->manager_count; m++) {
+        pthread_join(managers[m], NULL);
+    }
+    uint64_t elapsed = bench_now_ns() - begin;
+
+    // 모든 수가 적용되었는지 확인 (슬롯마다 자기 게임판만 바뀌어야 함)
+    for (int i = 0; i < slots; i++) {
+        if (shm->games[i].move_count != slot[i].moves) {
+            fprintf(stderr, "slot %d: %d of %d moves applied\n", i, shm->games[i].move_count, slot[i].moves);
+            exit(EXIT_FAILURE);
+        }
+    }
+    pthread_barrier_destroy(&start);
+    free(slot);
+    return elapsed;
+}
+
+int main(void) {
+    shm = aligned_alloc(SHM_CACHE_LINE, sizeof(SharedMemory));
+
+    printf("aggregate moves/sec by active game slots, %d moves in total (%ld CPUs)\n", TOTAL_MOVES,
+           sysconf(_SC_NPROCESSORS_ONLN));
+    printf("%5s  %-6s %10s %12s %10s %10s\n", "slots", "path", "seconds", "moves/sec", "efficiency", "contended");
+    double base[2] = { 0, 0 };
+    for (int slots = 1; slots <= SHM_MAX_GAMES; slots *= 2) {
+        for (int global = 0; global <= 1; global++) {
+            uint64_t elapsed = run(slots, global);
+            int moves = TOTAL_MOVES / slots * slots;
+            double rate = moves / (elapsed / 1e9);
+            if (slots == 1) {
+                base[global] = rate;
+            }
+            char waits[24] = "-";
+            if (global) {
+                snprintf(waits, sizeof(waits), "%ld", atomic_load(&contended));
+            }
+            printf("%5d  %-6s %10.3f %12.0f %9.1f%% %10s\n", slots, global ? "global" : "slots", elapsed / 1e9, rate,
+                   100.0 * rate / base[global], waits);
+            fflush(stdout);
+        }
+    }
+
+    free(shm);
+    return 0;
+}
@@ -0,0 +1,163 @@
+// bench_solver.c
+// 서버 봇(미리 푼 표)의 수 선택 지연과 정확성 확인
+//  table  : ttt_solved_move (게임판이 들고 있는 3진수 인덱스로 표 조회)
+//  search : 같은 배치에서 실행 중 미니맥스 완전 탐색 (표가 없을 때의 비용)
+//  verify : 봇이 선공/후공일 때 상대의 모든 수 순서를 끝까지 두어 봐서 봇이 한 번도 지지 않는지,
+//           도달 가능한 모든 배치에서 표의 값이 탐색 결과와 같은지 확인 (실패하면 종료 코드 1)
+#include <stdio.h>
+#include <stdlib.h>
+#include "ttt_engine.h"
+#include "ttt_solved.h"
+#include "bench_util.h"
+
+#define TABLE_ROUNDS 2000 // 표 조회는 배치 전체를 이만큼 반복해서 평균
+
+typedef struct
+{
+    long games, wins, draws, losses;
+} VerifyStats;
+
+static TttBoard positions[TTT_POSITIONS]; // 둘 수가 남은 도달 가능 배치
+static int position_count;
+
+// 3진수 인덱스 -> 비트보드
+static void decode(int index, TttBoard *board)
+{
+    ttt_init(board);
+    for (int cell = 0; cell < TTT_CELLS; cell++, index /= 3)
+    {
+        if (index % 3 != 0)
+            ttt_place(board, index % 3 - 1, cell);
+    }
+}
+
+static int side_to_move(const TttBoard *board)
+{
+    return __builtin_popcount(board->mask[0]) > __builtin_popcount(board->mask[1]);
+}
+
+// 실행 중 탐색: 둘 차례인 쪽 기준 값 (1: 승, 0: 무, -1: 패), best 에 최선의 칸
+static int search(const TttBoard *board, int player, int *best)
+{
+    if (ttt_winner(board) != -1)
+        return -1;
+    if (ttt_is_full(board))
+        return 0;
+    int value = -2;
+    for (int cell = 0; cell < TTT_CELLS && value < 1; cell++)
+    {
+        TttBoard next = *board;
+        if (ttt_place(&next, player, cell) == -1)
+            continue;
+        int child = -search(&next, 1 - player, NULL);
+        if (child > value)
+        {
+            value = child;
+            if (best != NULL)
+                *best = cell;
+        }
+    }
+    return value;
+}
+
+// 봇이 bot 쪽을 둘 때 상대의 모든 수를 시도
+static void play_all(const TttBoard *board, int player, int bot, VerifyStats *stats)
+{
+    int winner = ttt_winner(board);
+    if (winner != -1 || ttt_is_full(board))
+    {
+        stats->games++;
+        if (winner == -1)
+            stats->draws++;
+        else if (winner == bot)
+            stats->wins++;
+        else
+            stats->losses++;
+        return;
+    }
+    if (player == bot)
+    {
+        TttBoard next = *board;
+        if (ttt_place(&next, bot, ttt_solved_move(board)) == -1)
+        {
+            stats->losses++; // 표가 둘 수 없는 칸을 고름
+            return;
+        }
+        play_all(&next, 1 - player, bot, stats);
+        return;
+    }
+    for (int cell = 0; cell < TTT_CELLS; cell++)
+    {
+        TttBoard next = *board;
+        if (ttt_place(&next, player, cell) == 0)
+            play_all(&next, 1 - player, bot, stats);
+    }
+}
+
+int main(void)
+{
+    int mismatches = 0;
+    for (int index = 0; index < TTT_POSITIONS; index++)
+    {
+        uint8_t entry = ttt_solved[index];
+        if (entry == TTT_SOLVED_UNREACHABLE)
+            continue;
+        TttBoard board;
+        decode(index, &board);
+        int best = -1;
+        if (search(&board, side_to_move(&board), &best) != TTT_SOLVED_VALUE(entry))
+            mismatches++;
+        if (TTT_SOLVED_CELL(entry) != TTT_SOLVED_NO_MOVE)
+            positions[position_count++] = board;
+    }
+
+    // 표 조회: 배치마다 따로 재면 시계 비용이 더 크므로 전체를 반복한 평균
+    long sum = 0;
+    uint64_t start = bench_now_ns();
+    for (int round = 0; round < TABLE_ROUNDS; round++)
+    {
+        for (int i = 0; i < position_count; i++)
+            sum += ttt_solved_move(&positions[i]);
+    }
+    double table_ns = (double)(bench_now_ns() - start) / ((double)TABLE_ROUNDS * position_count);
+
+    // 탐색: 배치마다 한 번씩 재서 백분위수
+    uint64_t *samples = malloc(sizeof(uint64_t) * position_count);
+    uint64_t total = 0;
+    for (int i = 0; i < position_count; i++)
+    {
+        int best = -1;
+        uint64_t t0 = bench_now_ns();
+        search(&positions[i], side_to_move(&positions[i]), &best);
+        samples[i] = bench_now_ns() - t0;
+        total += samples[i];
+        sum += best;
+    }
+    bench_sort(samples, position_count);
+
+    printf("bot move latency over %d reachable positions with a move to make\n", position_count);
+    printf("%-8s %12s %12s %12s %12s\n", "method", "avg ns", "p50 ns", "p99 ns", "max ns");
+    printf("%-8s %12.1f %12s %12s %12s\n", "table", table_ns, "-", "-", "-");
+    printf("%-8s %12.1f %12lu %12lu %12lu\n", "search", (double)total / position_count,
+           (unsigned long)bench_percentile(samples, position_count, 0.5),
+           (unsigned long)bench_percentile(samples, position_count, 0.99),
+           (unsigned long)bench_percentile(samples, position_count, 1.0));
+    printf("(checksum %ld)\n", sum);
+    free(samples);
+
+    printf("\nverify against every opponent move sequence\n");
+    printf("%-8s %10s %10s %10s %10s\n", "bot", "games", "wins", "draws", "losses");
+    long losses = 0;
+    for (int bot = 0; bot < 2; bot++)
+    {
+        VerifyStats stats = {0};
+        TttBoard empty;
+        ttt_init(&empty);
+        play_all(&empty, 0, bot, &stats);
+        printf("%-8s %10ld %10ld %10ld %10ld\n", bot == 0 ? "X(first)" : "O(second)", stats.games, stats.wins,
+               stats.draws, stats.losses);
+        losses += stats.losses;
+    }
+    printf("table values that differ from search: %d\n", mismatches);
+    return losses == 0 && mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,136 @@
+// bench_syscount.c
+// 명령을 ptrace 로 실행하며 (모든 스레드/자식 포함) 시스템 호출 횟수를 종류별로 집계
+//  사용법: ./bench_syscount [-t turns] command [args...]
+//  -t 를 주면 턴당 평균도 함께 출력 (결과는 stderr)
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/ptrace.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+
+#define MAX_SYSCALL 512
+
+static const struct
+{
+    int nr;
+    const char *name;
+} syscall_names[] = {
+    {SYS_read, "read"}, {SYS_write, "write"}, {SYS_openat, "openat"}, {SYS_close, "close"},
+    {SYS_fstat, "fstat"}, {SYS_newfstatat, "newfstatat"}, {SYS_lseek, "lseek"},
+    {SYS_futex, "futex"}, {SYS_select, "select"}, {SYS_pselect6, "pselect6"},
+    {SYS_clock_nanosleep, "clock_nanosleep"}, {SYS_mmap, "mmap"}, {SYS_munmap, "munmap"},
+    {SYS_mprotect, "mprotect"}, {SYS_clone3, "clone3"}, {SYS_clone, "clone"},
+    {SYS_rt_sigprocmask, "rt_sigprocmask"}, {SYS_brk, "brk"}, {SYS_exit, "exit"},
+    {SYS_unlink, "unlink"}, {SYS_mknodat, "mknodat"}, {SYS_getrandom, "getrandom"},
+    {SYS_madvise, "madvise"}, {SYS_set_robust_list, "set_robust_list"},
+    {SYS_rseq, "rseq"}, {SYS_exit_group, "exit_group"}, {SYS_execve, "execve"},
+    {SYS_ioctl, "ioctl"}, {SYS_pread64, "pread64"}, {SYS_access, "access"},
+    {SYS_getdents64, "getdents64"}, {SYS_set_tid_address, "set_tid_address"},
+    {SYS_arch_prctl, "arch_prctl"}, {SYS_prlimit64, "prlimit64"},
+};
+
+static const char *syscall_name(int nr, char *buf, size_t size)
+{
+    for (size_t i = 0; i < sizeof(syscall_names) / sizeof(syscall_names[0]); i++)
+        if (syscall_names[i].nr == nr)
+            return syscall_names[i].name;
+    snprintf(buf, size, "sys_%d", nr);
+    return buf;
+}
+
+int main(int argc, char *argv[])
+{
+    int turns = 0;
+    int argi = 1;
+    if (argi + 1 < argc && strcmp(argv[argi], "-t") == 0)
+    {
+        turns = atoi(argv[argi + 1]);
+        argi += 2;
+    }
+    if (argi >= argc)
+    {
+        fprintf(stderr, "Usage: %s [-t turns] command [args...]\n", argv[0]);
+        return 1;
+    }
+
+    pid_t child = fork();
+    if (child == 0)
+    {
+        ptrace(PTRACE_TRACEME, 0, NULL, NULL);
+        raise(SIGSTOP);
+        execvp(argv[argi], &argv[argi]);
+        perror("execvp failed");
+        _exit(127);
+    }
+
+    int status;
+    waitpid(child, &status, 0);
+    ptrace(PTRACE_SETOPTIONS, child, NULL,
+           (void *)(long)(PTRACE_O_TRACESYSGOOD | PTRACE_O_TRACECLONE | PTRACE_O_TRACEFORK |
+                          PTRACE_O_TRACEVFORK | PTRACE_O_EXITKILL));
+    ptrace(PTRACE_SYSCALL, child, NULL, NULL);
+
+    static long counts[MAX_SYSCALL];
+    long total = 0;
+    int exit_code = 0;
+    for (;;)
+    {
+        pid_t tid = waitpid(-1, &status, __WALL);
+        if (tid == -1)
+            break;
+        if (WIFEXITED(status) || WIFSIGNALED(status))
+        {
+            if (tid == child)
+                exit_code = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+            continue;
+        }
+
+        int sig = WSTOPSIG(status);
+        if (sig == (SIGTRAP | 0x80))
+        {
+            // 시스템 호출 진입 시점에만 집계
+            struct __ptrace_syscall_info info;
+            if (ptrace(PTRACE_GET_SYSCALL_INFO, tid, (void *)sizeof(info), &info) > 0 &&
+                info.op == PTRACE_SYSCALL_INFO_ENTRY && info.entry.nr < MAX_SYSCALL)
+            {
+                counts[info.entry.nr]++;
+                total++;
+            }
+            sig = 0;
+        }
+        else if (sig == SIGTRAP || (status >> 16) != 0 || sig == SIGSTOP)
+        {
+            // ptrace 이벤트와 새 스레드의 시작 SIGSTOP 은 전달하지 않음
+            sig = 0;
+        }
+        ptrace(PTRACE_SYSCALL, tid, NULL, (void *)(long)sig);
+    }
+
+    char buf[32];
+    fprintf(stderr, "%-18s %10s", "syscall", "count");
+    if (turns > 0)
+        fprintf(stderr, " %10s", "per turn");
+    fprintf(stderr, "\n");
+    for (;;)
+    {
+        int best = -1;
+        for (int nr = 0; nr < MAX_SYSCALL; nr++)
+            if (counts[nr] > 0 && (best == -1 || counts[nr] > counts[best]))
+                best = nr;
+        if (best == -1)
+            break;
+        fprintf(stderr, "%-18s %10ld", syscall_name(best, buf, sizeof(buf)), counts[best]);
+        if (turns > 0)
+            fprintf(stderr, " %10.2f", (double)counts[best] / turns);
+        fprintf(stderr, "\n");
+        counts[best] = 0;
+    }
+    fprintf(stderr, "%-18s %10ld", "total", total);
+    if (turns > 0)
+        fprintf(stderr, " %10.2f", (double)total / turns);
+    fprintf(stderr, "\n");
+    return exit_code;
+}
@@ -0,0 +1,395 @@
+// bench_transport.c
+// 같은 스크립트 게임(9수 무승부)을 전송 방식만 바꿔 두 프로세스 사이에서 진행하며 턴 왕복 비교
+//  클라이언트(부모)가 수를 보내면 서버(자식)가 게임판에 적용하고 게임판을 돌려줌
+//  fifo        : 이름 있는 FIFO 두 개 + wire 프레임 (pipe_server 와 같은 경로)
+//  unix stream : socketpair(AF_UNIX, SOCK_STREAM) + wire 프레임
+//  unix seqpkt : socketpair(AF_UNIX, SOCK_SEQPACKET) + wire 프레임 (메시지 경계 유지)
+//  shm cond    : 공유 메모리 + 프로세스 공유 mutex/cond (기존 shmserver 방식)
+//  shm futex   : 공유 메모리 + 명령 링 + futex 이벤트 (현재 shmserver 방식)
+//  shm eventfd : 공유 메모리 + 명령 링 + eventfd 알림 (epoll 등 fd 기반 루프에 넣을 수 있는 형태)
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/eventfd.h>
+#include <sys/wait.h>
+#include "shm_common.h"
+#include "wire.h"
+#include "bench_util.h"
+
+#define GAMES 10000
+#define MOVES (GAMES * TTT_CELLS)
+#define HIST_BUCKETS 10 // <1us, 1~2us, 2~4us, ... , >=256us
+#define FIFO_PATH_MAX 256
+
+typedef enum { T_FIFO, T_UNIX_STREAM, T_UNIX_SEQPACKET, T_SHM_COND, T_SHM_FUTEX, T_SHM_EVENTFD } TransportKind;
+
+typedef struct {
+    pthread_mutex_t mutex;   // shm cond
+    pthread_cond_t cond;     // shm cond
+    int has_command;         // shm cond
+    ShmCommand command;      // shm cond
+    ShmRing commands;        // shm futex / eventfd
+    _Alignas(SHM_CACHE_LINE) _Atomic uint32_t ack_seq;
+    TttBoard board;          // 서버가 수를 적용한 뒤의 게임판 (응답)
+    ShmEvent command_event;  // shm futex
+    ShmEvent reply_event;    // shm futex
+} BenchShared;
+
+typedef struct {
+    int tx, rx;              // 바이트 스트림 경로의 보내기/받기 fd
+    int notify_tx, notify_rx; // shm eventfd 경로의 보내기/받기 eventfd
+    WireReader reader;
+} Endpoint;
+
+static BenchShared* shared;
+static TransportKind kind;
+
+static int is_stream(void) {
+    return kind == T_FIFO || kind == T_UNIX_STREAM || kind == T_UNIX_SEQPACKET;
+}
+
+static void eventfd_notify(int fd) {
+    uint64_t one = 1;
+    if (write(fd, &one, sizeof(one)) == -1) {
+        perror("eventfd write failed");
+    }
+}
+
+static void eventfd_wait(int fd) {
+    uint64_t count;
+    if (read(fd, &count, sizeof(count)) == -1) {
+        perror("eventfd read failed");
+    }
+}
+
+// 클라이언트: 수 하나를 보내고 게임판 응답을 받음 (cell 이 -1 이면 서버 종료 요청)
+static void client_move(Endpoint* ep, int cell, uint32_t seq, TttBoard* reply) {
+    if (is_stream()) {
+        WireMessage msg = {.type = cell < 0 ? WIRE_GAME_OVER : WIRE_MOVE, .row = cell / TTT_SIDE,
+                           .col = cell % TTT_SIDE, .turn = (int)seq};
+        wire_send(ep->tx, &msg);
+        if (cell < 0) {
+            return;
+        }
+        if (wire_recv(&ep->reader, ep->rx, &msg) != 1) {
+            fprintf(stderr, "reply lost\n");
+            exit(EXIT_FAILURE);
+        }
+        ttt_init(reply);
+        for (int i = 0; i < TTT_CELLS; i++) {
+            if (msg.cells[i] != MNK_EMPTY) {
+                ttt_place(reply, msg.cells[i], i);
+            }
+        }
+        return;
+    }
+
+    ShmCommand cmd = {.cell = cell, .seq = seq};
+    if (kind == T_SHM_COND) {
+        pthread_mutex_lock(&shared->mutex);
+        shared->command = cmd;
+        shared->has_command = 1;
+        pthread_cond_broadcast(&shared->cond);
+        while (cell >= 0 && atomic_load(&shared->ack_seq) != seq) {
+            pthread_cond_wait(&shared->cond, &shared->mutex);
+        }
+        *reply = shared->board;
+        pthread_mutex_unlock(&shared->mutex);
+        return;
+    }
+
+    while (shm_ring_push(&shared->commands, &cmd) == -1) {
+        SHM_CPU_RELAX();
+    }
+    if (kind == T_SHM_FUTEX) {
+        shm_event_signal(&shared->command_event);
+        for (;;) {
+            uint32_t seen = shm_event_prepare(&shared->reply_event);
+            if (cell < 0 || atomic_load_explicit(&shared->ack_seq, memory_order_acquire) == seq) {
+                break;
+            }
+            shm_event_wait(&shared->reply_event, seen);
+        }
+    }
+    else {
+        eventfd_notify(ep->notify_tx);
+        while (cell >= 0 && atomic_load_explicit(&shared->ack_seq, memory_order_acquire) != seq) {
+            eventfd_wait(ep->notify_rx);
+        }
+    }
+    *reply = shared->board;
+}
+
+// 서버: 다음 수 하나를 받음 (0: 수, -1: 종료)
+static int server_receive(Endpoint* ep, ShmCommand* cmd) {
+    if (is_stream()) {
+        WireMessage msg;
+        if (wire_recv(&ep->reader, ep->rx, &msg) != 1 || msg.type != WIRE_MOVE) {
+            return -1;
+        }
+        cmd->cell = msg.row * TTT_SIDE + msg.col;
+        cmd->seq = (uint32_t)msg.turn;
+        return 0;
+    }
+    if (kind == T_SHM_COND) {
+        pthread_mutex_lock(&shared->mutex);
+        while (!shared->has_command) {
+            pthread_cond_wait(&shared->cond, &shared->mutex);
+        }
+        *cmd = shared->command;
+        shared->has_command = 0;
+        pthread_mutex_unlock(&shared->mutex);
+        return cmd->cell < 0 ? -1 : 0;
+    }
+    for (;;) {
+        uint32_t seen = kind == T_SHM_FUTEX ? shm_event_prepare(&shared->command_event) : 0;
+        if (shm_ring_pop(&shared->commands, cmd)) {
+            return cmd->cell < 0 ? -1 : 0;
+        }
+        if (kind == T_SHM_FUTEX) {
+            shm_event_wait(&shared->command_event, seen);
+        }
+        else {
+            eventfd_wait(ep->notify_rx);
+        }
+    }
+}
+
+static void server_reply(Endpoint* ep, const TttBoard* board, uint32_t seq) {
+    if (is_stream()) {
+        WireMessage msg = {.type = WIRE_YOUR_TURN, .turn = (int)seq, .rows = TTT_SIDE, .cols = TTT_SIDE};
+        for (int i = 0; i < TTT_CELLS; i++) {
+            msg.cells[i] = (signed char)ttt_cell(board, i);
+        }
+        wire_send(ep->tx, &msg);
+        return;
+    }
+    if (kind == T_SHM_COND) {
+        pthread_mutex_lock(&shared->mutex);
+        shared->board = *board;
+        atomic_store(&shared->ack_seq, seq);
+        pthread_cond_broadcast(&shared->cond);
+        pthread_mutex_unlock(&shared->mutex);
+        return;
+    }
+    shared->board = *board;
+    atomic_store_explicit(&shared->ack_seq, seq, memory_order_release);
+    if (kind == T_SHM_FUTEX) {
+        shm_event_signal(&shared->reply_event);
+    }
+    else {
+        eventfd_notify(ep->notify_tx);
+    }
+}
+
+// 서버 프로세스: 수를 게임판에 적용하고 응답 (승부가 나거나 가득 차면 새 판)
+static void server_loop(Endpoint* ep) {
+    TttBoard board;
+    int turn = 0;
+    ttt_init(&board);
+    ShmCommand cmd;
+    while (server_receive(ep, &cmd) == 0) {
+        if (ttt_place(&board, turn, cmd.cell) == 0) {
+            turn = 1 - turn;
+        }
+        TttBoard reply = board;
+        if (ttt_winner(&board) != -1 || ttt_is_full(&board)) {
+            ttt_init(&board);
+            turn = 0;
+        }
+        server_reply(ep, &reply, cmd.seq);
+    }
+}
+
+// 전송 경로 준비: client/server 끝점을 채움 (fork 전에 만들어 두고 물려받음, FIFO 는 fork 후 열기)
+static int setup(Endpoint* client, Endpoint* server, const char* dir) {
+    memset(client, 0, sizeof(*client));
+    memset(server, 0, sizeof(*server));
+    wire_reader_init(&client->reader);
+    wire_reader_init(&server->reader);
+    memset(shared, 0, sizeof(*shared));
+    shm_ring_init(&shared->commands);
+    shm_event_init(&shared->command_event);
+    shm_event_init(&shared->reply_event);
+
+    if (kind == T_UNIX_STREAM || kind == T_UNIX_SEQPACKET) {
+        int sv[2];
+        if (socketpair(AF_UNIX, kind == T_UNIX_STREAM ? SOCK_STREAM : SOCK_SEQPACKET, 0, sv) == -1) {
+            perror("socketpair failed");
+            return -1;
+        }
+        client->tx = client->rx = sv[0];
+        server->tx = server->rx = sv[1];
+    }
+    else if (kind == T_SHM_COND) {
+        pthread_mutexattr_t mutex_attr;
+        pthread_condattr_t cond_attr;
+        pthread_mutexattr_init(&mutex_attr);
+        pthread_mutexattr_setpshared(&mutex_attr, PTHREAD_PROCESS_SHARED);
+        pthread_condattr_init(&cond_attr);
+        pthread_condattr_setpshared(&cond_attr, PTHREAD_PROCESS_SHARED);
+        pthread_mutex_init(&shared->mutex, &mutex_attr);
+        pthread_cond_init(&shared->cond, &cond_attr);
+    }
+    else if (kind == T_SHM_EVENTFD) {
+        int to_server = eventfd(0, 0), to_client = eventfd(0, 0);
+        if (to_server == -1 || to_client == -1) {
+            perror("eventfd failed");
+            return -1;
+        }
+        client->notify_tx = server->notify_rx = to_server;
+        client->notify_rx = server->notify_tx = to_client;
+    }
+    else if (kind == T_FIFO) {
+        static const char* names[] = {"to_server", "to_client"};
+        for (int i = 0; i < 2; i++) {
+            char name[FIFO_PATH_MAX];
+            snprintf(name, sizeof(name), "%s/%s", dir, names[i]);
+            unlink(name);
+            if (mkfifo(name, 0600) == -1) {
+                perror("mkfifo failed");
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+// FIFO 열기 (양쪽 모두 to_server 를 먼저 열어야 서로 기다리지 않음)
+static void open_fifos(Endpoint* ep, const char* dir, int is_server) {
+    char name[FIFO_PATH_MAX];
+    snprintf(name, sizeof(name), "%s/to_server", dir);
+    int to_server = open(name, is_server ? O_RDONLY : O_WRONLY);
+    snprintf(name, sizeof(name), "%s/to_client", dir);
+    int to_client = open(name, is_server ? O_WRONLY : O_RDONLY);
+    if (to_server == -1 || to_client == -1) {
+        perror("fifo open failed");
+        exit(EXIT_FAILURE);
+    }
+    ep->tx = is_server ? to_client : to_server;
+    ep->rx = is_server ? to_server : to_client;
+}
+
+static void teardown(Endpoint* client, Endpoint* server) {
+    if (kind == T_SHM_COND) {
+        pthread_mutex_destroy(&shared->mutex);
+        pthread_cond_destroy(&shared->cond);
+    }
+    int fds[] = {client->tx, client->rx, server->tx, server->rx, client->notify_tx, client->notify_rx};
+    for (size_t i = 0; i < sizeof(fds) / sizeof(fds[0]); i++) {
+        int dup_fd = 0;
+        for (size_t j = 0; j < i; j++) {
+            dup_fd |= fds[j] == fds[i];
+        }
+        if (fds[i] > 0 && !dup_fd) {
+            close(fds[i]);
+        }
+    }
+}
+
+static void run(const char* name, TransportKind k, const char* dir, uint64_t* samples) {
+    kind = k;
+    Endpoint client, server;
+    if (setup(&client, &server, dir) == -1) {
+        return;
+    }
+
+    pid_t pid = fork();
+    if (pid == 0) {
+        if (kind == T_FIFO) {
+            open_fifos(&server, dir, 1);
+        }
+        else if (is_stream()) {
+            close(client.tx);
+        }
+        server_loop(&server);
+        _exit(0);
+    }
+    if (kind == T_FIFO) {
+        open_fifos(&client, dir, 0);
+    }
+
+    TttBoard reply;
+    uint32_t seq = 0;
+    uint64_t begin = bench_now_ns();
+    for (int i = 0; i < MOVES; i++) {
+        uint64_t start = bench_now_ns();
+        client_move(&client, bench_draw_script[i % TTT_CELLS], ++seq, &reply);
+        samples[i] = bench_now_ns() - start;
+    }
+    double total = (double)(bench_now_ns() - begin);
+    client_move(&client, -1, ++seq, &reply);
+    waitpid(pid, NULL, 0);
+    teardown(&client, &server);
+
+    // 게임판이 제대로 오갔는지 확인: 마지막 응답은 9수를 모두 둔 무승부 게임판
+    if (!ttt_is_full(&reply)) {
+        fprintf(stderr, "%s: unexpected final board\n", name);
+    }
+
+    long hist[HIST_BUCKETS] = {0};
+    for (int i = 0; i < MOVES; i++) {
+        int bucket = 0;
+        for (uint64_t us = samples[i] / 1000; us > 0 && bucket < HIST_BUCKETS - 1; us >>= 1) {
+            bucket++;
+        }
+        hist[bucket]++;
+    }
+    bench_sort(samples, MOVES);
+    printf("%-12s %10.0f %8.2f %8.2f %8.2f %9.2f |", name, MOVES / total * 1e9,
+           bench_percentile(samples, MOVES, 0.5) / 1e3, bench_percentile(samples, MOVES, 0.99) / 1e3,
+           bench_percentile(samples, MOVES, 0.999) / 1e3, bench_percentile(samples, MOVES, 1.0) / 1e3);
+    for (int b = 0; b < HIST_BUCKETS; b++) {
+        printf(" %5.1f", 100.0 * hist[b] / MOVES);
+    }
+    printf("\n");
+    fflush(stdout);
+}
+
+int main(void) {
+    shared = mmap(NULL, sizeof(BenchShared), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (shared == MAP_FAILED) {
+        perror("mmap failed");
+        return 1;
+    }
+    char dir[] = "/tmp/ttt_transport_XXXXXX";
+    if (mkdtemp(dir) == NULL) {
+        perror("mkdtemp failed");
+        return 1;
+    }
+    uint64_t* samples = malloc(sizeof(uint64_t) * MOVES);
+
+    printf("scripted 9-move games, client and server processes, %d moves per transport (%ld CPUs)\n", MOVES,
+           sysconf(_SC_NPROCESSORS_ONLN));
+    printf("%-12s %10s %8s %8s %8s %9s | %% of turn round trips per bucket (us)\n", "transport", "moves/sec",
+           "p50 us", "p99 us", "p99.9 us", "max us");
+    printf("%-12s %10s %8s %8s %8s %9s |", "", "", "", "", "", "");
+    printf(" %5s", "<1");
+    for (int b = 1; b < HIST_BUCKETS - 1; b++) {
+        printf(" %5d", 1 << (b - 1));
+    }
+    printf(" %4d+\n", 1 << (HIST_BUCKETS - 2));
+
+    run("fifo", T_FIFO, dir, samples);
+    run("unix stream", T_UNIX_STREAM, dir, samples);
+    run("unix seqpkt", T_UNIX_SEQPACKET, dir, samples);
+    run("shm cond", T_SHM_COND, dir, samples);
+    run("shm futex", T_SHM_FUTEX, dir, samples);
+    run("shm eventfd", T_SHM_EVENTFD, dir, samples);
+
+    char name[FIFO_PATH_MAX];
+    snprintf(name, sizeof(name), "%s/to_server", dir);
+    unlink(name);
+    snprintf(name, sizeof(name), "%s/to_client", dir);
+    unlink(name);
+    rmdir(dir);
+    free(samples);
+    munmap(shared, sizeof(BenchShared));
+    return 0;
+}
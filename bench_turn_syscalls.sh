@@ -0,0 +1,38 @@
+#!/bin/sh
+# bench_turn_syscalls.sh
+# 서버/클라이언트의 턴당 시스템 호출 수 측정
+#  9수 무승부 게임과 5수 승리 게임을 각각 bench_syscount 로 실행하고
+#  (9수 게임 횟수 - 5수 게임 횟수) / 4 로 시작/종료 비용을 뺀 턴당 비용을 계산
+#  사용법: ./bench_turn_syscalls.sh [server] [client]
+SERVER=${1:-./server}
+CLIENT=${2:-./client}
+SYSCOUNT=./bench_syscount
+DIR=$(mktemp -d /tmp/ttt_syscalls_XXXXXX)
+
+# $1: 결과 접두사, $2: 플레이어 0 입력, $3: 플레이어 1 입력
+run_game() {
+    $SYSCOUNT $SERVER -d "$DIR" > /dev/null 2> "$DIR/$1.server" &
+    sleep 0.3
+    (printf "$2"; sleep 1) | $SYSCOUNT $CLIENT 0 0 "$DIR" > /dev/null 2> "$DIR/$1.client0" &
+    sleep 0.1
+    (printf "$3"; sleep 1) | $SYSCOUNT $CLIENT 1 0 "$DIR" > /dev/null 2> "$DIR/$1.client1" &
+    wait
+}
+
+run_game long '1 1\n0 2\n1 0\n0 1\n2 2\n' '0 0\n2 0\n1 2\n2 1\n'
+run_game short '0 0\n0 1\n0 2\n' '1 0\n1 1\n'
+
+for who in server client0 client1; do
+    echo "== $who: syscalls per turn =="
+    awk 'FNR == 1 { next }
+         FILENAME ~ /long/  { long[$1] = $2 }
+         FILENAME ~ /short/ { short[$1] = $2 }
+         END {
+             for (name in long) {
+                 diff = (long[name] - short[name]) / 4
+                 if (name != "total" && diff != 0) printf "  %-16s %6.2f\n", name, diff
+             }
+             printf "  %-16s %6.2f\n", "total", (long["total"] - short["total"]) / 4
+         }' "$DIR/long.$who" "$DIR/short.$who" | sort -k2 -rn
+done
+rm -rf "$DIR"
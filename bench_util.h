@@ -0,0 +1,55 @@
+// bench_util.h
+// 벤치마크 공용 도우미 (시간 측정, 백분위수, 자원 한도)
+#ifndef BENCH_UTIL_H
+#define BENCH_UTIL_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+#include <sys/resource.h>
+
+// 무승부로 끝나는 9수 순서 (셀 번호 0~8, X와 O가 번갈아 둠)
+static const int bench_draw_script[9] = {4, 0, 2, 6, 3, 5, 1, 7, 8};
+
+// 단조 시계 (나노초)
+static inline uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static int bench_cmp_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+// 표본 정렬 (bench_percentile 호출 전에 한 번)
+static inline void bench_sort(uint64_t *samples, size_t n)
+{
+    qsort(samples, n, sizeof(uint64_t), bench_cmp_u64);
+}
+
+// 정렬된 표본의 백분위수 반환 (p: 0.0 ~ 1.0)
+static inline uint64_t bench_percentile(const uint64_t *samples, size_t n, double p)
+{
+    if (n == 0)
+        return 0;
+    size_t idx = (size_t)(p * (double)(n - 1) + 0.5);
+    return samples[idx];
+}
+
+// 열린 파일 수 한도를 최대치로 올리고 현재 한도를 반환
+static inline long bench_raise_fd_limit(void)
+{
+    struct rlimit rl;
+    if (getrlimit(RLIMIT_NOFILE, &rl) == -1)
+        return -1;
+    rl.rlim_cur = rl.rlim_max;
+    setrlimit(RLIMIT_NOFILE, &rl);
+    getrlimit(RLIMIT_NOFILE, &rl);
+    return (long)rl.rlim_cur;
+}
+
+#endif
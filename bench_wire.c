@@ -0,0 +1,271 @@
+// bench_wire.c
+// FIFO 메시지 파서 처리량 비교
+//  text : 기존 방식 ("Your Turn|..." / "row col time" 문자열, strncmp 분기 + sscanf)
+//  wire : 길이 접두 이진 프레임 + WireReader 재조립
+//  두 방식 모두 같은 메시지 열을 무작위 크기 조각으로 나눠 넣어 부분/병합 read 를 흉내냄
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "wire.h"
+#include "bench_util.h"
+
+#define MESSAGES 200000
+#define ROUNDS 5
+#define MAX_CHUNK 1024 // read 한 번에 돌아오는 최대 바이트 (무작위)
+
+typedef struct
+{
+    long messages;
+    long checksum;
+} ParseResult;
+
+// 게임 진행과 비슷한 메시지 열 생성 (차례 알림, 수, 가끔 잘못된 수/게임 종료)
+static void make_message(WireMessage *msg, int i)
+{
+    memset(msg, 0, sizeof(*msg));
+    msg->session = i % 100;
+    msg->player = i % 2;
+    msg->timestamp_ns = (uint64_t)i * 1000;
+    switch (i % 10)
+    {
+    case 9:
+        msg->type = WIRE_GAME_OVER;
+        msg->winner = i % 3;
+        break;
+    case 7:
+        msg->type = WIRE_INVALID_MOVE;
+        break;
+    default:
+        if (i % 2 == 0)
+        {
+            msg->type = WIRE_YOUR_TURN;
+            msg->turn = i % 2;
+            msg->rows = msg->cols = 3;
+            msg->row = msg->col = -1;
+            for (int c = 0; c < 9; c++)
+                msg->cells[c] = (signed char)((i + c) % 3 - 1);
+        }
+        else
+        {
+            msg->type = WIRE_MOVE;
+            msg->row = i % 3;
+            msg->col = (i / 3) % 3;
+            msg->think_ns = 1500000;
+        }
+    }
+}
+
+// 파서가 꺼낸 값을 섞어 두 방식의 결과가 같은지 확인
+static long mix(const WireMessage *msg)
+{
+    long sum = msg->type * 131 + msg->session;
+    if (msg->type == WIRE_MOVE)
+        sum += msg->row * 7 + msg->col;
+    else if (msg->type == WIRE_GAME_OVER)
+        sum += msg->winner * 11;
+    else if (msg->type == WIRE_YOUR_TURN)
+        for (int c = 0; c < msg->rows * msg->cols; c++)
+            sum += (c + 1) * (msg->cells[c] + 1);
+    return sum;
+}
+
+// 기존 문자열 형식으로 기록 ('\0' 으로 끝나는 메시지)
+static size_t text_encode(const WireMessage *msg, char *out)
+{
+    int len;
+    switch (msg->type)
+    {
+    case WIRE_YOUR_TURN:
+        len = sprintf(out, "Your Turn|%d|%d|%d|%d|", msg->session, msg->turn, msg->rows, msg->cols);
+        for (int c = 0; c < msg->rows * msg->cols; c++)
+            out[len++] = (char)('1' + msg->cells[c]);
+        out[len] = '\0';
+        break;
+    case WIRE_MOVE:
+        len = sprintf(out, "%d %d %d %.3f", msg->session, msg->row, msg->col, msg->think_ns / 1e9);
+        break;
+    case WIRE_GAME_OVER:
+        len = sprintf(out, "Game Over|%d|Winner:%d", msg->session, msg->winner);
+        break;
+    default:
+        len = sprintf(out, "Invalid Move|%d", msg->session);
+    }
+    return (size_t)len + 1;
+}
+
+// 문자열 메시지 하나 파싱 (기존 strncmp 분기 + sscanf)
+static int text_parse(const char *p, WireMessage *msg)
+{
+    int offset = 0;
+    if (strncmp(p, "Your Turn", 9) == 0)
+    {
+        msg->type = WIRE_YOUR_TURN;
+        if (sscanf(p, "Your Turn|%d|%d|%d|%d|%n", &msg->session, &msg->turn, &msg->rows, &msg->cols, &offset) != 4)
+            return -1;
+        for (int c = 0; c < msg->rows * msg->cols; c++)
+            msg->cells[c] = (signed char)(p[offset + c] - '1');
+    }
+    else if (strncmp(p, "Game Over", 9) == 0)
+    {
+        msg->type = WIRE_GAME_OVER;
+        if (sscanf(p, "Game Over|%d|Winner:%d", &msg->session, &msg->winner) != 2)
+            return -1;
+    }
+    else if (strncmp(p, "Invalid Move", 12) == 0)
+    {
+        msg->type = WIRE_INVALID_MOVE;
+        if (sscanf(p, "Invalid Move|%d", &msg->session) != 1)
+            return -1;
+    }
+    else
+    {
+        double elapsed;
+        msg->type = WIRE_MOVE;
+        if (sscanf(p, "%d %d %d %lf", &msg->session, &msg->row, &msg->col, &elapsed) != 4)
+            return -1;
+        msg->think_ns = (uint64_t)(elapsed * 1e9);
+    }
+    return 0;
+}
+
+// 문자열 스트림 파싱: 조각 경계에 걸친 메시지는 다음 조각과 이어 붙임
+static ParseResult run_text(const char *stream, size_t size, const size_t *chunks)
+{
+    ParseResult result = {0, 0};
+    static char buffer[2 * MAX_CHUNK + 512];
+    size_t pending = 0, pos = 0;
+    WireMessage msg;
+    for (int c = 0; pos < size; c++)
+    {
+        size_t n = chunks[c];
+        if (n > size - pos)
+            n = size - pos;
+        memcpy(buffer + pending, stream + pos, n);
+        pos += n;
+        pending += n;
+
+        size_t start = 0;
+        for (;;)
+        {
+            char *end = memchr(buffer + start, '\0', pending - start);
+            if (end == NULL)
+                break;
+            if (text_parse(buffer + start, &msg) == 0)
+            {
+                result.messages++;
+                result.checksum += mix(&msg);
+            }
+            start = (size_t)(end - buffer) + 1;
+        }
+        memmove(buffer, buffer + start, pending - start);
+        pending -= start;
+    }
+    return result;
+}
+
+// 기존 서버/클라이언트처럼 read 한 번 = 메시지 하나로 가정했을 때 실제로 처리되는 메시지 수
+static long run_text_one_per_read(const char *stream, size_t size, const size_t *chunks)
+{
+    long parsed = 0;
+    char buffer[MAX_CHUNK + 1];
+    size_t pos = 0;
+    WireMessage msg;
+    for (int c = 0; pos < size; c++)
+    {
+        size_t n = chunks[c];
+        if (n > size - pos)
+            n = size - pos;
+        memcpy(buffer, stream + pos, n);
+        buffer[n] = '\0';
+        pos += n;
+        if (text_parse(buffer, &msg) == 0)
+            parsed++; // 첫 메시지만 보고 나머지는 버려짐
+    }
+    return parsed;
+}
+
+static ParseResult run_wire(const uint8_t *stream, size_t size, const size_t *chunks)
+{
+    ParseResult result = {0, 0};
+    static WireReader reader;
+    wire_reader_init(&reader);
+    size_t pos = 0;
+    WireMessage msg;
+    for (int c = 0; pos < size; c++)
+    {
+        size_t n = chunks[c];
+        if (n > size - pos)
+            n = size - pos;
+        pos += wire_reader_push(&reader, stream + pos, n);
+        int rc;
+        while ((rc = wire_reader_next(&reader, &msg)) == 1)
+        {
+            result.messages++;
+            result.checksum += mix(&msg);
+        }
+        if (rc == WIRE_CORRUPT)
+        {
+            fprintf(stderr, "corrupt wire stream\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    return result;
+}
+
+int main(void)
+{
+    char *text = malloc((size_t)MESSAGES * 64);
+    uint8_t *wire = malloc((size_t)MESSAGES * 64);
+    size_t text_size = 0, wire_size = 0;
+    WireMessage msg;
+    for (int i = 0; i < MESSAGES; i++)
+    {
+        make_message(&msg, i);
+        text_size += text_encode(&msg, text + text_size);
+        wire_size += wire_encode(&msg, wire + wire_size, WIRE_MAX_FRAME);
+    }
+
+    // 무작위 read 크기 (1 ~ MAX_CHUNK 바이트), 두 방식에 같은 순서 사용
+    size_t max_size = text_size > wire_size ? text_size : wire_size;
+    size_t *chunks = malloc(sizeof(size_t) * (max_size + 1));
+    srand(2024);
+    for (size_t c = 0; c <= max_size; c++)
+        chunks[c] = 1 + (size_t)rand() % MAX_CHUNK;
+
+    printf("%d messages, text %zu bytes (%.1f B/msg), wire %zu bytes (%.1f B/msg)\n",
+           MESSAGES, text_size, (double)text_size / MESSAGES, wire_size, (double)wire_size / MESSAGES);
+
+    ParseResult text_result = {0, 0}, wire_result = {0, 0};
+    double text_best = 1e30, wire_best = 1e30;
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        uint64_t start = bench_now_ns();
+        text_result = run_text(text, text_size, chunks);
+        double elapsed = (double)(bench_now_ns() - start);
+        if (elapsed < text_best)
+            text_best = elapsed;
+
+        start = bench_now_ns();
+        wire_result = run_wire(wire, wire_size, chunks);
+        elapsed = (double)(bench_now_ns() - start);
+        if (elapsed < wire_best)
+            wire_best = elapsed;
+    }
+
+    printf("%-6s  %10s  %10s  %12s\n", "parser", "messages", "ns/msg", "Mmsg/s");
+    printf("%-6s  %10ld  %10.1f  %12.2f\n", "text", text_result.messages, text_best / MESSAGES,
+           MESSAGES / text_best * 1e3);
+    printf("%-6s  %10ld  %10.1f  %12.2f\n", "wire", wire_result.messages, wire_best / MESSAGES,
+           MESSAGES / wire_best * 1e3);
+    printf("speedup %.1fx, results %s\n", text_best / wire_best,
+           (text_result.messages == wire_result.messages && text_result.checksum == wire_result.checksum)
+               ? "match"
+               : "MISMATCH");
+    printf("text with one message per read(): %ld of %d messages parsed\n",
+           run_text_one_per_read(text, text_size, chunks), MESSAGES);
+
+    free(chunks);
+    free(text);
+    free(wire);
+    return text_result.checksum == wire_result.checksum ? 0 : 1;
+}
@@ -0,0 +1,302 @@
+// bot_client.c
+// 터미널 없이 두는 봇 클라이언트 겸 부하 생성기 (FIFO 서버, 공유 메모리 서버 모두 지원)
+//  fifo: 실행 중인 ./server -s N 의 세션 0..N-1 에 동시에 접속, 세션마다 스레드 하나가 두 플레이어를 둠
+//        턴 왕복 = 수를 보낸 시점부터 상대에게 Your Turn(또는 Game Over)이 도착한 시점까지
+//  shm : 실행 중인 ./shmserver -g N 의 게임 0..N-1 에 두 플레이어로 접속, 플레이어마다 스레드 하나
+//        턴 왕복 = 명령 링에 수를 넣은 시점부터 서버의 ack 를 받은 시점까지
+//  수 선택: script (3x3 무승부 순서, 다른 크기는 random) 또는 random (빈 칸 중 무작위)
+//  사용법: ./bot [-t fifo|shm] [-s sessions] [-d fifo_dir] [-m script|random] [-r seed]
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include "pipe_session.h"
+#include "shm_common.h"
+#include "bench_util.h"
+#include "bench_pipe_bot.h"
+
+#define BOT_STACK_SIZE (64 * 1024)
+#define BOT_MAX_MOVES MNK_MAX_CELLS
+
+typedef struct
+{
+    int id;            // 세션 ID (fifo) 또는 자리 번호 (shm, 게임 슬롯 * 2 + 플레이어)
+    const char *dir;
+    int random;        // 1: 무작위 수, 0: 스크립트
+    unsigned seed;
+    uint64_t *samples; // 턴 왕복 시간 (ns)
+    int count;
+    int games;         // 끝까지 진행한 게임 수
+} BotWorker;
+
+static const char *transport = "fifo";
+
+// 빈 칸 중 하나 선택 (cells: MNK_EMPTY 면 빈 칸), 빈 칸이 없으면 -1
+static int choose_cell(BotWorker *bot, const signed char *cells, int n, int move_index)
+{
+    if (!bot->random && n == TTT_CELLS && move_index < TTT_CELLS &&
+        cells[bench_draw_script[move_index]] == MNK_EMPTY)
+        return bench_draw_script[move_index];
+
+    int empty = 0;
+    for (int i = 0; i < n; i++)
+        empty += cells[i] == MNK_EMPTY;
+    if (empty == 0)
+        return -1;
+    int pick = rand_r(&bot->seed) % empty;
+    for (int i = 0; i < n; i++)
+    {
+        if (cells[i] == MNK_EMPTY && pick-- == 0)
+            return i;
+    }
+    return -1;
+}
+
+// FIFO 세션 하나: 두 플레이어를 번갈아 두며 턴 왕복 시간 기록
+static void *fifo_worker(void *arg)
+{
+    BotWorker *bot = (BotWorker *)arg;
+    BenchBotConn conn[MAX_CLIENTS];
+    for (int p = 0; p < MAX_CLIENTS; p++)
+    {
+        if (bench_bot_open(&conn[p], bot->dir, bot->id, p) == -1)
+            return NULL;
+    }
+
+    WireMessage msg;
+    int p = 0;
+    do
+    {
+        if (bench_bot_recv(&conn[p], &msg) != 1)
+            goto done;
+    } while (msg.type != WIRE_YOUR_TURN);
+    for (int move = 0; bot->count < BOT_MAX_MOVES; move++)
+    {
+        // 차례 알림에 담긴 게임판에서 빈 칸 선택
+        int cell = choose_cell(bot, msg.cells, msg.rows * msg.cols, move);
+        if (cell == -1)
+            break;
+        uint64_t start = bench_now_ns();
+        if (bench_bot_move_at(&conn[p], cell / msg.cols, cell % msg.cols) == -1)
+            break;
+
+        // 상대에게 차례 또는 게임 종료가 도착할 때까지
+        int next = 1 - p;
+        if (bench_bot_recv(&conn[next], &msg) != 1)
+            break;
+        bot->samples[bot->count++] = bench_now_ns() - start;
+        if (msg.type == WIRE_GAME_OVER)
+        {
+            bench_bot_wait(&conn[p], WIRE_GAME_OVER);
+            bot->games++;
+            break;
+        }
+        if (msg.type != WIRE_YOUR_TURN)
+            break;
+        p = next;
+    }
+
+done:
+    for (int q = 0; q < MAX_CLIENTS; q++)
+        bench_bot_close(&conn[q]);
+    return NULL;
+}
+
+static SharedMemory *shared_mem;
+
+// 공유 메모리 플레이어 하나: 차례가 오면 명령 링으로 수를 보내고 ack 까지의 시간 기록
+static void *shm_worker(void *arg)
+{
+    BotWorker *bot = (BotWorker *)arg;
+    ShmGame *game = &shared_mem->games[bot->id / MAX_CLIENTS];
+    int me = bot->id % MAX_CLIENTS;
+    ShmEvent *my_event = &game->player_event[me];
+    uint32_t seq = 0;
+
+    for (;;)
+    {
+        ShmGameView view;
+        for (;;)
+        {
+            uint32_t seen = shm_event_prepare(my_event);
+            shm_state_snapshot(game, &view);
+            if (view.turn == me || view.game_over)
+                break;
+            shm_event_wait(my_event, seen);
+        }
+        if (view.game_over)
+        {
+            bot->games += me == 0; // 한 게임을 두 스레드가 함께 두므로 한 번만 셈
+            break;
+        }
+
+        signed char cells[TTT_CELLS];
+        for (int i = 0; i < TTT_CELLS; i++)
+            cells[i] = (signed char)ttt_cell(&view.board, i);
+        int cell = choose_cell(bot, cells, TTT_CELLS, view.move_count);
+        if (cell == -1)
+            break;
+
+        uint64_t start = bench_now_ns();
+        ShmCommand cmd = {.cell = cell, .seq = ++seq, .sent_ns = start};
+        if (shm_ring_push(&game->commands[me], &cmd) == -1)
+            break;
+        shm_game_notify(shared_mem, game);
+        for (;;)
+        {
+            uint32_t seen = shm_event_prepare(my_event);
+            if (atomic_load_explicit(&game->ack_seq[me], memory_order_acquire) == seq)
+                break;
+            shm_event_wait(my_event, seen);
+        }
+        bot->samples[bot->count++] = bench_now_ns() - start;
+    }
+    return NULL;
+}
+
+// shmserver 의 게임 0..games-1 에 두 플레이어로 접속 (shmclient 와 같은 자리 비트맵)
+static int shm_attach(int games)
+{
+    int shm_id = shmget(SHM_KEY, sizeof(SharedMemory), 0666);
+    if (shm_id < 0)
+    {
+        perror("shmget failed (shmserver 실행 중인지 확인)");
+        return -1;
+    }
+    shared_mem = (SharedMemory *)shmat(shm_id, NULL, 0);
+    if (shared_mem == (void *)-1)
+    {
+        perror("shmat failed");
+        return -1;
+    }
+    if (atomic_load_explicit(&shared_mem->magic, memory_order_acquire) != SHM_MAGIC ||
+        games > shared_mem->game_count)
+    {
+        fprintf(stderr, "서버가 준비되지 않았거나 게임이 %d개보다 적습니다 (shmserver -g %d).\n", games, games);
+        shmdt(shared_mem);
+        return -1;
+    }
+    for (int slot = 0; slot < games; slot++)
+    {
+        uint64_t mask[SHM_SEAT_WORDS];
+        shm_seat_mask(slot, mask);
+        for (int p = 0; p < MAX_CLIENTS; p++)
+        {
+            if (shm_claim_seat(shared_mem, mask) == -1)
+            {
+                fprintf(stderr, "게임 %d에 이미 접속한 클라이언트가 있습니다.\n", slot);
+                shmdt(shared_mem);
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s [-t fifo|shm] [-s sessions] [-d fifo_dir] [-m script|random] [-r seed]\n", prog);
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char *argv[])
+{
+    int sessions = 1;
+    const char *dir = ".";
+    int random = 0;
+    unsigned seed = 1;
+    int opt;
+    while ((opt = getopt(argc, argv, "t:s:d:m:r:")) != -1)
+    {
+        switch (opt)
+        {
+        case 't':
+            transport = optarg;
+            break;
+        case 's':
+            sessions = atoi(optarg);
+            break;
+        case 'd':
+            dir = optarg;
+            break;
+        case 'm':
+            random = strcmp(optarg, "random") == 0;
+            break;
+        case 'r':
+            seed = (unsigned)atoi(optarg);
+            break;
+        default:
+            usage(argv[0]);
+        }
+    }
+    int use_shm = strcmp(transport, "shm") == 0;
+    if ((!use_shm && strcmp(transport, "fifo") != 0) || sessions <= 0 || optind != argc)
+        usage(argv[0]);
+
+    // fifo: 세션마다 스레드 하나, shm: 게임마다 플레이어 스레드 두 개
+    if (use_shm && sessions > SHM_MAX_GAMES)
+        usage(argv[0]);
+    int workers = use_shm ? sessions * MAX_CLIENTS : sessions;
+    if (use_shm && shm_attach(sessions) == -1)
+        exit(EXIT_FAILURE);
+    bench_raise_fd_limit();
+
+    BotWorker *bots = calloc(workers, sizeof(BotWorker));
+    pthread_t *threads = calloc(workers, sizeof(pthread_t));
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, BOT_STACK_SIZE);
+
+    uint64_t begin = bench_now_ns();
+    for (int i = 0; i < workers; i++)
+    {
+        bots[i].id = i;
+        bots[i].dir = dir;
+        bots[i].random = random;
+        bots[i].seed = seed * 7919u + (unsigned)i;
+        bots[i].samples = calloc(BOT_MAX_MOVES, sizeof(uint64_t));
+        if (pthread_create(&threads[i], &attr, use_shm ? shm_worker : fifo_worker, &bots[i]) != 0)
+        {
+            perror("pthread_create failed");
+            exit(EXIT_FAILURE);
+        }
+    }
+    for (int i = 0; i < workers; i++)
+        pthread_join(threads[i], NULL);
+    double elapsed = (double)(bench_now_ns() - begin) / 1e9;
+
+    // 모든 스레드의 표본을 모아 백분위수 계산
+    long moves = 0, games = 0;
+    for (int i = 0; i < workers; i++)
+    {
+        moves += bots[i].count;
+        games += bots[i].games;
+    }
+    uint64_t *all = calloc(moves > 0 ? moves : 1, sizeof(uint64_t));
+    long n = 0;
+    for (int i = 0; i < workers; i++)
+    {
+        memcpy(all + n, bots[i].samples, sizeof(uint64_t) * bots[i].count);
+        n += bots[i].count;
+        free(bots[i].samples);
+    }
+    bench_sort(all, moves);
+
+    printf("transport %s, %d %s, %s moves\n", transport, workers, use_shm ? "players" : "sessions",
+           random ? "random" : "scripted");
+    printf("%8s %8s %10s %12s %10s %10s %10s\n", "games", "moves", "elapsed s", "moves/sec", "p50 us", "p99 us",
+           "p99.9 us");
+    printf("%8ld %8ld %10.3f %12.0f %10.2f %10.2f %10.2f\n", games, moves, elapsed, moves / elapsed,
+           bench_percentile(all, moves, 0.5) / 1e3, bench_percentile(all, moves, 0.99) / 1e3,
+           bench_percentile(all, moves, 0.999) / 1e3);
+
+    if (use_shm)
+        shmdt(shared_mem);
+    free(all);
+    free(threads);
+    free(bots);
+    return games > 0 ? 0 : 1;
+}
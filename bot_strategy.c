@@ -0,0 +1,88 @@
+// bot_strategy.c
+#include <stdlib.h>
+#include <string.h>
+#include "bot_strategy.h"
+#include "ttt_solved.h"
+
+// 빈 칸 중 무작위
+static int choose_random(const GameState *game, int player, unsigned *seed)
+{
+    (void)player;
+    const MnkBoard *board = &game->board;
+    int n = board->rows * board->cols;
+    int empty = n - board->filled;
+    if (empty <= 0)
+        return -1;
+    int pick = rand_r(seed) % empty;
+    for (int i = 0; i < n; i++)
+    {
+        if (board->cells[i] == MNK_EMPTY && pick-- == 0)
+            return i;
+    }
+    return -1;
+}
+
+// 첫 번째 빈 칸 (가장 약한 기준선)
+static int choose_first(const GameState *game, int player, unsigned *seed)
+{
+    (void)player;
+    (void)seed;
+    const MnkBoard *board = &game->board;
+    for (int i = 0; i < board->rows * board->cols; i++)
+    {
+        if (board->cells[i] == MNK_EMPTY)
+            return i;
+    }
+    return -1;
+}
+
+// 바로 이기는 칸, 없으면 상대가 바로 이기는 칸을 막고, 그것도 없으면 무작위
+//  후보 칸마다 게임판 사본에 놓아 보고 mnk_wins_at 으로 확인 (서버 판정과 같은 규칙)
+static int choose_greedy(const GameState *game, int player, unsigned *seed)
+{
+    MnkBoard trial = game->board;
+    int n = trial.rows * trial.cols;
+    for (int who = 0; who < 2; who++)
+    {
+        int stone = who == 0 ? player : 1 - player;
+        for (int i = 0; i < n; i++)
+        {
+            if (trial.cells[i] != MNK_EMPTY)
+                continue;
+            int row = i / trial.cols, col = i % trial.cols;
+            mnk_place(&trial, stone, row, col);
+            int wins = mnk_wins_at(&trial, row, col);
+            mnk_clear(&trial, row, col);
+            if (wins)
+                return i;
+        }
+    }
+    return choose_random(game, player, seed);
+}
+
+// 3x3: 미리 푼 표의 최선의 수 (지지 않음), 다른 크기는 greedy
+static int choose_perfect(const GameState *game, int player, unsigned *seed)
+{
+    if (!game->classic)
+        return choose_greedy(game, player, seed);
+    int cell = ttt_solved_move(&game->bits);
+    return cell != -1 ? cell : choose_random(game, player, seed);
+}
+
+const BotStrategy bot_strategies[] = {
+    {"random", "빈 칸 중 무작위", choose_random},
+    {"first", "첫 번째 빈 칸", choose_first},
+    {"greedy", "이기는 칸 > 막는 칸 > 무작위", choose_greedy},
+    {"perfect", "3x3 미리 푼 표 (다른 크기는 greedy)", choose_perfect},
+};
+const int bot_strategy_count = sizeof(bot_strategies) / sizeof(bot_strategies[0]);
+
+const BotStrategy *bot_strategy_find(const char *name)
+{
+    for (int i = 0; i < bot_strategy_count; i++)
+    {
+        if (strcmp(bot_strategies[i].name, name) == 0)
+            return &bot_strategies[i];
+    }
+    return NULL;
+}
@@ -0,0 +1,26 @@
+// bot_strategy.h
+// 봇 전략 모음: 게임 상태를 보고 둘 칸 하나를 고름 (대국 도구 ttt-tournament 에서 사용)
+//  전략은 이름과 함수 포인터 하나로 등록하므로 bot_strategies 표에 항목을 더하면 바로 대국에 나갈 수 있음
+//  전략 함수는 게임 상태를 바꾸지 않고 호출마다 독립적이어야 함 (여러 스레드가 동시에 호출)
+#ifndef BOT_STRATEGY_H
+#define BOT_STRATEGY_H
+
+#include "pipe_session.h"
+
+// 둘 차례인 player 의 칸 (row * cols + col) 반환, 둘 곳이 없으면 -1
+//  seed: 호출한 스레드의 난수 상태 (rand_r)
+typedef int (*BotChooseFn)(const GameState *game, int player, unsigned *seed);
+
+typedef struct
+{
+    const char *name;
+    const char *description;
+    BotChooseFn choose;
+} BotStrategy;
+
+extern const BotStrategy bot_strategies[];
+extern const int bot_strategy_count;
+
+const BotStrategy *bot_strategy_find(const char *name); // 없으면 NULL
+
+#endif
@@ -0,0 +1,79 @@
+// hdr_hist.c
+#include <string.h>
+#include "hdr_hist.h"
+
+#define HDR_MAX_VALUE ((1ull << HDR_MAX_EXP) - 1)
+
+static int bucket_index(uint64_t value)
+{
+    if (value > HDR_MAX_VALUE)
+        value = HDR_MAX_VALUE;
+    if (value < HDR_SUB_COUNT)
+        return (int)value; // 첫 줄은 값 그대로 (오차 없음)
+    int exp = 63 - __builtin_clzll(value);
+    int shift = exp - HDR_SUB_BITS;
+    return (shift + 1) * HDR_SUB_COUNT + (int)((value >> shift) - HDR_SUB_COUNT);
+}
+
+// 칸에 속한 가장 큰 값
+static uint64_t bucket_highest(int index)
+{
+    int row = index / HDR_SUB_COUNT, sub = index % HDR_SUB_COUNT;
+    if (row == 0)
+        return (uint64_t)sub;
+    int shift = row - 1;
+    return (((uint64_t)(HDR_SUB_COUNT + sub) + 1) << shift) - 1;
+}
+
+void hdr_init(HdrHist *hist)
+{
+    memset(hist, 0, sizeof(*hist));
+    hist->min = UINT64_MAX;
+}
+
+void hdr_record(HdrHist *hist, uint64_t value)
+{
+    hist->buckets[bucket_index(value)]++;
+    hist->count++;
+    hist->total += value;
+    if (value < hist->min)
+        hist->min = value;
+    if (value > hist->max)
+        hist->max = value;
+}
+
+void hdr_merge(HdrHist *dst, const HdrHist *src)
+{
+    if (src->count == 0)
+        return;
+    for (int i = 0; i < HDR_BUCKETS; i++)
+        dst->buckets[i] += src->buckets[i];
+    dst->count += src->count;
+    dst->total += src->total;
+    if (src->min < dst->min)
+        dst->min = src->min;
+    if (src->max > dst->max)
+        dst->max = src->max;
+}
+
+uint64_t hdr_percentile(const HdrHist *hist, double p)
+{
+    if (hist->count == 0)
+        return 0;
+    uint64_t rank = (uint64_t)(p * (double)(hist->count - 1)) + 1, seen = 0;
+    for (int i = 0; i < HDR_BUCKETS; i++)
+    {
+        seen += hist->buckets[i];
+        if (seen >= rank)
+        {
+            uint64_t value = bucket_highest(i);
+            return value < hist->max ? value : hist->max;
+        }
+    }
+    return hist->max;
+}
+
+double hdr_mean(const HdrHist *hist)
+{
+    return hist->count == 0 ? 0.0 : (double)hist->total / (double)hist->count;
+}
@@ -0,0 +1,116 @@
+// journal.c
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "journal.h"
+
+static JournalHeader *header; // NULL: 열지 않음 (기록하지 않음)
+static JournalRecord *records;
+static size_t mapped_size;
+static int journal_fd = -1;
+
+static uint64_t journal_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+int journal_open(const char *path, const char *server, int rows, int cols, int k, uint64_t capacity)
+{
+    int fd = open(path, O_CREAT | O_TRUNC | O_RDWR | O_CLOEXEC, 0644);
+    if (fd == -1)
+    {
+        perror("open journal failed");
+        return -1;
+    }
+    // 블록까지 미리 할당: 기록 중에 디스크가 차서 SIGBUS 를 받는 일이 없도록
+    size_t size = JOURNAL_HEADER_SIZE + capacity * sizeof(JournalRecord);
+    int rc = posix_fallocate(fd, 0, (off_t)size);
+    if (rc != 0)
+    {
+        fprintf(stderr, "posix_fallocate journal failed: %s\n", strerror(rc));
+        close(fd);
+        return -1;
+    }
+    // MAP_POPULATE 로 페이지를 미리 읽어 두고, 공유 매핑은 첫 쓰기에 다시 폴트가 나므로 페이지마다 한 번씩 써 둠
+    //  수를 기록할 때는 커널에 들어가지 않음 (디스크 쓰기 후 다시 쓰기 보호된 페이지는 예외)
+    void *map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, 0);
+    if (map == MAP_FAILED)
+    {
+        perror("mmap journal failed");
+        close(fd);
+        return -1;
+    }
+    long page = sysconf(_SC_PAGESIZE);
+    for (size_t offset = 0; offset < size; offset += (size_t)page)
+        ((volatile char *)map)[offset] = 0;
+
+    JournalHeader *h = map;
+    h->version = JOURNAL_VERSION;
+    h->rows = (uint32_t)rows;
+    h->cols = (uint32_t)cols;
+    h->k = (uint32_t)k;
+    h->record_size = sizeof(JournalRecord);
+    h->capacity = capacity;
+    h->start_ns = journal_now_ns();
+    atomic_store_explicit(&h->next, 0, memory_order_relaxed);
+    snprintf(h->server, sizeof(h->server), "%s", server);
+    h->magic = JOURNAL_MAGIC;
+
+    journal_fd = fd;
+    mapped_size = size;
+    records = (JournalRecord *)((char *)map + JOURNAL_HEADER_SIZE);
+    header = h;
+    return 0;
+}
+
+void journal_close(void)
+{
+    if (header == NULL)
+        return;
+    uint64_t used = atomic_load(&header->next);
+    if (used > header->capacity)
+    {
+        fprintf(stderr, "journal full: %lu records dropped (capacity %lu)\n",
+                (unsigned long)(used - header->capacity), (unsigned long)header->capacity);
+        used = header->capacity;
+    }
+    msync(header, mapped_size, MS_SYNC);
+    munmap(header, mapped_size);
+    if (ftruncate(journal_fd, (off_t)(JOURNAL_HEADER_SIZE + used * sizeof(JournalRecord))) == -1)
+        perror("ftruncate journal failed");
+    close(journal_fd);
+    header = NULL;
+    records = NULL;
+    journal_fd = -1;
+}
+
+// 칸 하나를 예약해 내용을 쓰고 type 을 마지막에 공개
+static void journal_append(int session, int player, int cell, JournalType type)
+{
+    if (header == NULL)
+        return;
+    uint64_t index = atomic_fetch_add_explicit(&header->next, 1, memory_order_relaxed);
+    if (index >= header->capacity)
+        return;
+    JournalRecord *record = &records[index];
+    record->timestamp_ns = journal_now_ns();
+    record->session = (uint32_t)session;
+    record->cell = (uint16_t)cell;
+    record->player = (uint8_t)player;
+    atomic_store_explicit(&record->type, (uint8_t)type, memory_order_release);
+}
+
+void journal_move(int session, int player, int cell)
+{
+    journal_append(session, player, cell, JOURNAL_MOVE);
+}
+
+void journal_end(int session, int winner)
+{
+    journal_append(session, winner == -1 ? JOURNAL_ABORTED : winner, 0, JOURNAL_END);
+}
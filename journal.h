@@ -0,0 +1,55 @@
+// journal.h
+// 추가 전용 이진 수 기록(journal): 미리 크기를 잡아 둔 파일을 mmap 하여 고정 크기 레코드를 차례로 씀
+//  수 하나 기록은 원자 증가 한 번과 16바이트 저장뿐이라 시스템 호출이 없음 (페이지도 열 때 미리 채움)
+//  프로세스가 죽어도 MAP_SHARED 페이지는 커널 페이지 캐시에 남으므로 파일에 남음, ttt-replay 로 다시 검증
+//  기록 순서: 레코드 내용을 먼저 쓰고 type 을 마지막에 release 로 씀 (type 0 인 칸은 쓰다 만 레코드)
+//  열지 않은 프로세스에서는 기록 함수가 아무 일도 하지 않음
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <stdatomic.h>
+#include <stdint.h>
+
+#define JOURNAL_MAGIC 0x7474746au        // "tttj"
+#define JOURNAL_VERSION 1
+#define JOURNAL_HEADER_SIZE 64           // 레코드는 파일의 64바이트 위치부터
+#define JOURNAL_CAPACITY (1u << 20)      // 기본 레코드 수 (16 MiB), 넘친 기록은 버리고 개수만 셈
+#define JOURNAL_ABORTED 0xff             // 게임 종료 레코드의 결과: 연결이 끊겨 중단됨
+
+typedef enum
+{
+    JOURNAL_EMPTY, // 예약만 되고 쓰이지 않은 칸 (기록 도중 프로세스가 죽음)
+    JOURNAL_MOVE,  // cell 에 수, player 가 둔 플레이어
+    JOURNAL_END    // player 에 결과 (0, 1: 승자, 2: 무승부, JOURNAL_ABORTED: 중단), 같은 세션의 다음 수는 새 게임
+} JournalType;
+
+typedef struct
+{
+    uint64_t timestamp_ns; // CLOCK_MONOTONIC
+    uint32_t session;
+    uint16_t cell;         // row * cols + col
+    uint8_t player;
+    _Atomic uint8_t type;  // JournalType, 마지막에 씀
+} JournalRecord;
+
+typedef struct
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t rows, cols, k;  // 기록한 서버의 게임판 (한 서버는 한 가지 게임판)
+    uint32_t record_size;
+    uint64_t capacity;       // 파일에 잡아 둔 레코드 수
+    uint64_t start_ns;       // 기록 시작 시각 (CLOCK_MONOTONIC)
+    _Atomic uint64_t next;   // 예약한 레코드 수 (capacity 를 넘으면 넘친 만큼 버려짐)
+    char server[16];
+} JournalHeader;
+
+_Static_assert(sizeof(JournalRecord) == 16, "journal record must stay 16 bytes");
+_Static_assert(sizeof(JournalHeader) <= JOURNAL_HEADER_SIZE, "journal header must fit before the records");
+
+int journal_open(const char *path, const char *server, int rows, int cols, int k, uint64_t capacity); // -1: 실패
+void journal_close(void); // 쓴 만큼으로 파일을 줄이고 디스크에 반영
+void journal_move(int session, int player, int cell);
+void journal_end(int session, int winner); // winner: 0, 1, 2 (무승부), -1 (중단)
+
+#endif
@@ -0,0 +1,62 @@
+// lobby.c
+#include "lobby.h"
+
+void lobby_init(Lobby *lobby)
+{
+    lobby->head.prev = &lobby->head;
+    lobby->head.next = &lobby->head;
+    lobby->head.queued_ns = 0;
+    lobby->count = 0;
+}
+
+void lobby_entry_init(LobbyEntry *entry)
+{
+    entry->prev = NULL;
+    entry->next = NULL;
+    entry->queued_ns = 0;
+}
+
+int lobby_queued(const LobbyEntry *entry)
+{
+    return entry->next != NULL;
+}
+
+void lobby_push(Lobby *lobby, LobbyEntry *entry, uint64_t now_ns)
+{
+    LobbyEntry *tail = lobby->head.prev;
+    entry->prev = tail;
+    entry->next = &lobby->head;
+    entry->queued_ns = now_ns;
+    tail->next = entry;
+    lobby->head.prev = entry;
+    lobby->count++;
+}
+
+void lobby_remove(Lobby *lobby, LobbyEntry *entry)
+{
+    if (!lobby_queued(entry))
+        return;
+    entry->prev->next = entry->next;
+    entry->next->prev = entry->prev;
+    entry->prev = NULL;
+    entry->next = NULL;
+    lobby->count--;
+}
+
+LobbyEntry *lobby_pop(Lobby *lobby)
+{
+    if (lobby->count == 0)
+        return NULL;
+    LobbyEntry *entry = lobby->head.next;
+    lobby_remove(lobby, entry);
+    return entry;
+}
+
+int lobby_pair(Lobby *lobby, LobbyEntry **first, LobbyEntry **second)
+{
+    if (lobby->count < 2)
+        return 0;
+    *first = lobby_pop(lobby);
+    *second = lobby_pop(lobby);
+    return 1;
+}
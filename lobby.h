@@ -0,0 +1,34 @@
+// lobby.h
+// 매칭 대기열: 도착 순서대로 두 명씩 짝지음
+//  대기자 구조체 안에 LobbyEntry 를 넣어 두는 침입형 이중 연결 리스트 (별도 할당 없음)
+//  넣기, 짝짓기(앞의 두 명 꺼내기), 중간에서 빼기(대기 중 접속 종료) 모두 O(1)
+#ifndef LOBBY_H
+#define LOBBY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// 항목 포인터에서 그 항목을 품은 구조체 포인터 얻기
+#define LOBBY_OWNER(entry, type, member) ((type *)((char *)(entry) - offsetof(type, member)))
+
+typedef struct LobbyEntry
+{
+    struct LobbyEntry *prev, *next; // next 가 NULL 이면 대기열에 없음
+    uint64_t queued_ns;             // 대기열에 들어온 시각 (매칭 대기 시간 측정용)
+} LobbyEntry;
+
+typedef struct
+{
+    LobbyEntry head; // 원형 리스트의 기준 항목 (head.next: 가장 오래 기다린 대기자)
+    long count;
+} Lobby;
+
+void lobby_init(Lobby *lobby);
+void lobby_entry_init(LobbyEntry *entry);
+int lobby_queued(const LobbyEntry *entry);                   // 대기열에 있으면 1
+void lobby_push(Lobby *lobby, LobbyEntry *entry, uint64_t now_ns); // 맨 뒤에 넣기
+LobbyEntry *lobby_pop(Lobby *lobby);                          // 맨 앞 꺼내기 (비었으면 NULL)
+void lobby_remove(Lobby *lobby, LobbyEntry *entry);           // 대기열 어디에 있든 빼기
+int lobby_pair(Lobby *lobby, LobbyEntry **first, LobbyEntry **second); // 두 명 이상이면 앞의 둘을 꺼내고 1
+
+#endif
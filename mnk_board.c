@@ -0,0 +1,97 @@
+// mnk_board.c
+#include <string.h>
+#include "mnk_board.h"
+
+// 네 방향 (가로, 세로, 대각선 \, 대각선 /)
+static const int directions[4][2] = {{0, 1}, {1, 0}, {1, 1}, {1, -1}};
+
+int mnk_init(MnkBoard *board, int rows, int cols, int k)
+{
+    if (rows < 1 || rows > MNK_MAX_SIDE || cols < 1 || cols > MNK_MAX_SIDE)
+        return -1;
+    if (k < 1 || (k > rows && k > cols))
+        return -1;
+    board->rows = rows;
+    board->cols = cols;
+    board->k = k;
+    mnk_reset(board);
+    return 0;
+}
+
+void mnk_reset(MnkBoard *board)
+{
+    memset(board->cells, MNK_EMPTY, (size_t)board->rows * board->cols);
+    board->filled = 0;
+}
+
+int mnk_place(MnkBoard *board, int player, int row, int col)
+{
+    if (row < 0 || row >= board->rows || col < 0 || col >= board->cols)
+        return -1; // 잘못된 좌표
+    signed char *cell = &board->cells[row * board->cols + col];
+    if (*cell != MNK_EMPTY)
+        return -1; // 이미 수가 존재함
+    *cell = (signed char)player;
+    board->filled++;
+    return 0;
+}
+
+void mnk_clear(MnkBoard *board, int row, int col)
+{
+    signed char *cell = &board->cells[row * board->cols + col];
+    if (*cell != MNK_EMPTY)
+    {
+        *cell = MNK_EMPTY;
+        board->filled--;
+    }
+}
+
+int mnk_cell(const MnkBoard *board, int row, int col)
+{
+    return board->cells[row * board->cols + col];
+}
+
+char mnk_cell_char(const MnkBoard *board, int row, int col)
+{
+    static const char symbols[3] = {' ', 'X', 'O'};
+    return symbols[mnk_cell(board, row, col) + 1];
+}
+
+// 한 방향으로 같은 돌이 몇 개 이어지는지 (시작 칸 제외, 최대 limit 개)
+static int run_length(const MnkBoard *board, int player, int row, int col, int dr, int dc, int limit)
+{
+    int count = 0;
+    for (int i = 1; i <= limit; i++)
+    {
+        int r = row + dr * i, c = col + dc * i;
+        if (r < 0 || r >= board->rows || c < 0 || c >= board->cols)
+            break;
+        if (board->cells[r * board->cols + c] != player)
+            break;
+        count++;
+    }
+    return count;
+}
+
+int mnk_wins_at(const MnkBoard *board, int row, int col)
+{
+    int player = mnk_cell(board, row, col);
+    if (player == MNK_EMPTY)
+        return 0;
+    int need = board->k - 1;
+    for (int d = 0; d < 4; d++)
+    {
+        int dr = directions[d][0], dc = directions[d][1];
+        int count = run_length(board, player, row, col, dr, dc, need);
+        if (count < need)
+            count += run_length(board, player, row, col, -dr, -dc, need - count);
+        if (count >= need)
+            return 1;
+    }
+    return 0;
+}
+
+int mnk_is_full(const MnkBoard *board)
+{
+    return board->filled == board->rows * board->cols;
+}
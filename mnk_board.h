@@ -0,0 +1,28 @@
+// mnk_board.h
+// 범용 m×n 게임판, k목 (가로/세로/대각선으로 k개를 먼저 잇는 쪽이 승리)
+//  승리 판정은 마지막 수를 지나는 네 줄만 확인하므로 수마다 O(k)
+#ifndef MNK_BOARD_H
+#define MNK_BOARD_H
+
+#define MNK_MAX_SIDE 19 // 한 변의 최대 길이 (바둑판 크기)
+#define MNK_MAX_CELLS (MNK_MAX_SIDE * MNK_MAX_SIDE)
+#define MNK_EMPTY (-1)
+
+typedef struct
+{
+    int rows, cols; // 게임판 크기
+    int k;          // 승리에 필요한 연속 돌 수
+    int filled;     // 놓인 돌 수 (무승부 판정용)
+    signed char cells[MNK_MAX_CELLS]; // MNK_EMPTY, 0(X), 1(O), 인덱스는 row * cols + col
+} MnkBoard;
+
+int mnk_init(MnkBoard *board, int rows, int cols, int k); // 0: 성공, -1: 잘못된 크기
+void mnk_reset(MnkBoard *board);
+int mnk_place(MnkBoard *board, int player, int row, int col); // 0: 성공, -1: 잘못된 칸 또는 이미 놓임
+void mnk_clear(MnkBoard *board, int row, int col);            // 수 되돌리기 (탐색용)
+int mnk_cell(const MnkBoard *board, int row, int col);        // MNK_EMPTY, 0 또는 1
+char mnk_cell_char(const MnkBoard *board, int row, int col);  // ' ', 'X', 'O'
+int mnk_wins_at(const MnkBoard *board, int row, int col);     // (row, col)의 돌이 k목을 완성했으면 1
+int mnk_is_full(const MnkBoard *board);
+
+#endif
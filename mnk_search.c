@@ -0,0 +1,464 @@
+// mnk_search.c
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+#include "mnk_search.h"
+
+#define MATE_BOUND (MNK_SEARCH_WIN - MNK_MAX_CELLS) // 이보다 크면 강제 승 (작으면 강제 패)
+#define NEAR_RADIUS 2      // 후보 수: 이 거리 안에 돌이 있는 빈 칸만
+#define CHECK_INTERVAL 1023 // 노드 1024개마다 시간 확인
+#define WEIGHT_SHIFT_MAX 18 // 창 가치의 상한 2^18 (모든 창을 더해도 MATE_BOUND 아래)
+
+enum
+{
+    BOUND_EXACT,
+    BOUND_LOWER, // 실제 값 >= 점수 (beta 컷)
+    BOUND_UPPER  // 실제 값 <= 점수 (모든 수가 alpha 이하)
+};
+
+#define TT_MOVE(data) ((int)((data) & 0xffff) - 1)
+#define TT_DEPTH(data) ((int)(((data) >> 16) & 0xff))
+#define TT_BOUND(data) ((int)(((data) >> 24) & 0x3))
+#define TT_SCORE(data) ((int)(int32_t)((data) >> 32))
+
+// 스레드 하나의 탐색 상태: 게임판 사본과 수마다 갱신하는 창별 돌 수, 평가값, 해시
+typedef struct MnkSearchWorker
+{
+    MnkSearch *search;
+    int id;
+    MnkBoard board;
+    uint8_t counts[MNK_SEARCH_MAX_WINDOWS][2]; // 창별 플레이어 돌 수
+    int score[2];                // 플레이어별: 상대 돌이 없는 창의 가치 합
+    uint8_t near[MNK_MAX_CELLS]; // 칸마다 NEAR_RADIUS 안의 돌 수
+    uint64_t hash;
+    uint64_t nodes;
+} SearchWorker;
+
+static void *search_thread(void *arg);
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static uint64_t splitmix64(uint64_t *state)
+{
+    uint64_t z = (*state += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+int mnk_search_init(MnkSearch *search, int threads, int tt_bits)
+{
+    memset(search, 0, sizeof(*search));
+    search->threads = threads > 0 ? threads : 1;
+    search->table_mask = (1ull << tt_bits) - 1;
+    search->table = calloc(search->table_mask + 1, sizeof(MnkTtEntry));
+    if (search->table == NULL)
+        return -1;
+    uint64_t seed = 0x6d6e6b5f73656172ull; // 고정 시드: 같은 국면이면 실행마다 같은 해시
+    for (int p = 0; p < 2; p++)
+    {
+        for (int cell = 0; cell < MNK_MAX_CELLS; cell++)
+            search->zobrist[p][cell] = splitmix64(&seed);
+    }
+    search->side_key = splitmix64(&seed);
+    search->base_key = splitmix64(&seed) | 1;
+    pthread_mutex_init(&search->lock, NULL);
+    pthread_cond_init(&search->start_cond, NULL);
+    pthread_cond_init(&search->done_cond, NULL);
+
+    // 탐색 스레드는 여기서 한 번만 만듦 (호출한 스레드의 작은 스택과 무관하게 깊이 들어감)
+    search->workers = calloc(search->threads, sizeof(SearchWorker));
+    search->thread_ids = calloc(search->threads, sizeof(pthread_t));
+    int started = 0;
+    if (search->workers != NULL && search->thread_ids != NULL)
+    {
+        for (; started < search->threads; started++)
+        {
+            search->workers[started].search = search;
+            if (pthread_create(&search->thread_ids[started], NULL, search_thread, &search->workers[started]) != 0)
+                break;
+        }
+    }
+    search->threads = started;
+    if (started == 0)
+    {
+        mnk_search_destroy(search);
+        return -1;
+    }
+    return 0;
+}
+
+void mnk_search_destroy(MnkSearch *search)
+{
+    pthread_mutex_lock(&search->lock);
+    search->quit = 1;
+    pthread_cond_broadcast(&search->start_cond);
+    pthread_mutex_unlock(&search->lock);
+    for (int i = 0; i < search->threads; i++)
+        pthread_join(search->thread_ids[i], NULL);
+    free(search->workers);
+    free(search->thread_ids);
+    free(search->table);
+    search->workers = NULL;
+    search->thread_ids = NULL;
+    search->table = NULL;
+    search->threads = 0;
+    pthread_cond_destroy(&search->start_cond);
+    pthread_cond_destroy(&search->done_cond);
+    pthread_mutex_destroy(&search->lock);
+}
+
+void mnk_search_clear(MnkSearch *search)
+{
+    memset(search->table, 0, (search->table_mask + 1) * sizeof(MnkTtEntry));
+}
+
+// 게임판 크기에 맞춰 k칸 창 목록과 창 가치를 만듦
+static void setup_geometry(MnkSearch *search, const MnkBoard *board)
+{
+    static const int directions[4][2] = {{0, 1}, {1, 0}, {1, 1}, {1, -1}};
+    int rows = board->rows, cols = board->cols, k = board->k;
+    search->rows = rows;
+    search->cols = cols;
+    search->k = k;
+    memset(search->cell_window_count, 0, sizeof(search->cell_window_count));
+
+    int count = 0;
+    for (int d = 0; d < 4; d++)
+    {
+        int dr = directions[d][0], dc = directions[d][1];
+        for (int r = 0; r < rows; r++)
+        {
+            for (int c = 0; c < cols; c++)
+            {
+                int end_r = r + dr * (k - 1), end_c = c + dc * (k - 1);
+                if (end_r >= rows || end_c < 0 || end_c >= cols)
+                    continue;
+                for (int i = 0; i < k; i++)
+                {
+                    int cell = (r + dr * i) * cols + (c + dc * i);
+                    search->cell_windows[cell][search->cell_window_count[cell]++] = (uint16_t)count;
+                }
+                count++;
+            }
+        }
+    }
+    search->window_count = count;
+
+    // 돌이 하나 늘 때마다 가치가 8배 (k-1 개짜리 창이 그보다 짧은 창 여럿보다 급함)
+    search->weights[0] = 0;
+    for (int c = 1; c <= k; c++)
+    {
+        int shift = 3 * (c - 1);
+        search->weights[c] = 1 << (shift < WEIGHT_SHIFT_MAX ? shift : WEIGHT_SHIFT_MAX);
+    }
+    mnk_search_clear(search);
+}
+
+// 창 하나가 평가값에 더하는 몫 (두 플레이어 돌이 섞인 창은 아무도 완성할 수 없으므로 0)
+static inline void window_score(SearchWorker *w, const uint8_t *count, int sign)
+{
+    const int *weights = w->search->weights;
+    if (count[1] == 0)
+        w->score[0] += sign * weights[count[0]];
+    if (count[0] == 0)
+        w->score[1] += sign * weights[count[1]];
+}
+
+static void update_near(SearchWorker *w, int cell, int delta)
+{
+    int rows = w->board.rows, cols = w->board.cols;
+    int row = cell / cols, col = cell % cols;
+    for (int r = row - NEAR_RADIUS; r <= row + NEAR_RADIUS; r++)
+    {
+        if (r < 0 || r >= rows)
+            continue;
+        for (int c = col - NEAR_RADIUS; c <= col + NEAR_RADIUS; c++)
+        {
+            if (c >= 0 && c < cols)
+                w->near[r * cols + c] += delta;
+        }
+    }
+}
+
+// 수 두기/되돌리기: 게임판 규칙은 mnk_board 그대로, 창별 돌 수와 평가값, 해시를 함께 갱신
+static void worker_place(SearchWorker *w, int player, int cell)
+{
+    const MnkSearch *search = w->search;
+    mnk_place(&w->board, player, cell / w->board.cols, cell % w->board.cols);
+    w->hash ^= search->zobrist[player][cell];
+    for (int i = 0; i < search->cell_window_count[cell]; i++)
+    {
+        uint8_t *count = w->counts[search->cell_windows[cell][i]];
+        window_score(w, count, -1);
+        count[player]++;
+        window_score(w, count, 1);
+    }
+    update_near(w, cell, 1);
+}
+
+static void worker_undo(SearchWorker *w, int player, int cell)
+{
+    const MnkSearch *search = w->search;
+    mnk_clear(&w->board, cell / w->board.cols, cell % w->board.cols);
+    w->hash ^= search->zobrist[player][cell];
+    for (int i = 0; i < search->cell_window_count[cell]; i++)
+    {
+        uint8_t *count = w->counts[search->cell_windows[cell][i]];
+        window_score(w, count, -1);
+        count[player]--;
+        window_score(w, count, 1);
+    }
+    update_near(w, cell, -1);
+}
+
+static void worker_setup(SearchWorker *w, MnkSearch *search, int id, const MnkBoard *board)
+{
+    memset(w, 0, sizeof(*w));
+    w->search = search;
+    w->id = id;
+    mnk_init(&w->board, board->rows, board->cols, board->k);
+    w->hash = search->base_key;
+    for (int cell = 0; cell < board->rows * board->cols; cell++)
+    {
+        if (board->cells[cell] != MNK_EMPTY)
+            worker_place(w, board->cells[cell], cell);
+    }
+}
+
+// 수 순서용 급한 정도: 이 칸이 내 창을 키우는 가치 + 상대 창을 막는 가치
+static int urgency(const SearchWorker *w, int player, int cell)
+{
+    const MnkSearch *search = w->search;
+    int value = 0;
+    for (int i = 0; i < search->cell_window_count[cell]; i++)
+    {
+        const uint8_t *count = w->counts[search->cell_windows[cell][i]];
+        if (count[1 - player] == 0)
+            value += search->weights[count[player] + 1];
+        if (count[player] == 0)
+            value += search->weights[count[1 - player] + 1];
+    }
+    return value;
+}
+
+// 후보 수를 급한 순서로 (치환표의 수가 맨 앞), 스레드마다 동점 순서를 달리해서 서로 다른 가지를 먼저 봄
+static int generate_moves(const SearchWorker *w, int player, int tt_move, int *moves)
+{
+    int cells = w->board.rows * w->board.cols;
+    if (w->board.filled == 0)
+    {
+        moves[0] = (w->board.rows / 2) * w->board.cols + w->board.cols / 2; // 빈 게임판은 가운데
+        return 1;
+    }
+
+    int keys[MNK_MAX_CELLS];
+    int count = 0;
+    for (int pass = 0; pass < 2 && count == 0; pass++)
+    {
+        // 첫 번째는 돌 근처만, 근처가 모두 찼으면 두 번째에 모든 빈 칸
+        for (int cell = 0; cell < cells; cell++)
+        {
+            if (w->board.cells[cell] != MNK_EMPTY || (pass == 0 && w->near[cell] == 0))
+                continue;
+            int key = cell == tt_move ? INT_MAX : (urgency(w, player, cell) << 4) | ((cell * 7 + w->id * 5) & 15);
+            int i = count++;
+            while (i > 0 && keys[i - 1] < key)
+            {
+                keys[i] = keys[i - 1];
+                moves[i] = moves[i - 1];
+                i--;
+            }
+            keys[i] = key;
+            moves[i] = cell;
+        }
+    }
+    return count;
+}
+
+// 강제 승/패 점수는 루트까지의 거리를 빼고 저장 (다른 깊이에서 읽어도 같은 뜻)
+static int score_to_tt(int score, int ply)
+{
+    return score > MATE_BOUND ? score + ply : (score < -MATE_BOUND ? score - ply : score);
+}
+
+static int score_from_tt(int score, int ply)
+{
+    return score > MATE_BOUND ? score - ply : (score < -MATE_BOUND ? score + ply : score);
+}
+
+static int tt_probe(const MnkSearch *search, uint64_t key, uint64_t *data)
+{
+    MnkTtEntry *entry = &search->table[key & search->table_mask];
+    uint64_t value = atomic_load_explicit(&entry->data, memory_order_relaxed);
+    uint64_t check = atomic_load_explicit(&entry->check, memory_order_relaxed);
+    if ((check ^ value) != key)
+        return 0; // 다른 국면이거나 쓰는 도중에 읽은 항목
+    *data = value;
+    return 1;
+}
+
+static void tt_store(MnkSearch *search, uint64_t key, int move, int depth, int bound, int score)
+{
+    MnkTtEntry *entry = &search->table[key & search->table_mask];
+    uint64_t value = (uint64_t)(uint16_t)(move + 1) | (uint64_t)(depth & 0xff) << 16 | (uint64_t)bound << 24 |
+                     (uint64_t)(uint32_t)score << 32;
+    atomic_store_explicit(&entry->data, value, memory_order_relaxed);
+    atomic_store_explicit(&entry->check, key ^ value, memory_order_relaxed);
+}
+
+// 네가맥스 알파-베타, best_move 가 NULL 이 아니면 루트 (치환표 값으로 끝내지 않고 최선의 수를 돌려줌)
+static int negamax(SearchWorker *w, int player, int depth, int alpha, int beta, int ply, int *best_move)
+{
+    MnkSearch *search = w->search;
+    if ((++w->nodes & CHECK_INTERVAL) == 0 && now_ns() >= search->deadline_ns)
+        atomic_store_explicit(&search->stop, 1, memory_order_relaxed);
+    if (atomic_load_explicit(&search->stop, memory_order_relaxed))
+        return 0;
+    if (mnk_is_full(&w->board))
+        return 0; // 무승부
+    if (depth == 0)
+        return w->score[player] - w->score[1 - player];
+
+    uint64_t key = w->hash ^ (player ? search->side_key : 0);
+    uint64_t data;
+    int tt_move = -1;
+    if (tt_probe(search, key, &data))
+    {
+        tt_move = TT_MOVE(data);
+        int score = score_from_tt(TT_SCORE(data), ply);
+        int bound = TT_BOUND(data);
+        if (best_move == NULL && TT_DEPTH(data) >= depth &&
+            (bound == BOUND_EXACT || (bound == BOUND_LOWER && score >= beta) || (bound == BOUND_UPPER && score <= alpha)))
+            return score;
+    }
+
+    int moves[MNK_MAX_CELLS];
+    int count = generate_moves(w, player, tt_move, moves);
+    int original_alpha = alpha, best = -MNK_SEARCH_WIN - 1, best_cell = moves[0];
+    for (int i = 0; i < count; i++)
+    {
+        int cell = moves[i];
+        worker_place(w, player, cell);
+        int score;
+        if (mnk_wins_at(&w->board, cell / w->board.cols, cell % w->board.cols))
+            score = MNK_SEARCH_WIN - ply; // 이 수로 k목 완성
+        else
+            score = -negamax(w, 1 - player, depth - 1, -beta, -alpha, ply + 1, NULL);
+        worker_undo(w, player, cell);
+        if (atomic_load_explicit(&search->stop, memory_order_relaxed))
+            return 0;
+        if (score > best)
+        {
+            best = score;
+            best_cell = cell;
+            if (score > alpha)
+                alpha = score;
+            if (alpha >= beta)
+                break;
+        }
+    }
+
+    int bound = best <= original_alpha ? BOUND_UPPER : (best >= beta ? BOUND_LOWER : BOUND_EXACT);
+    tt_store(search, key, best_cell, depth, bound, score_to_tt(best, ply));
+    if (best_move != NULL)
+        *best_move = best_cell;
+    return best;
+}
+
+// 스레드 하나의 반복 심화: 깊이 하나를 끝까지 마칠 때마다 공유 결과를 더 깊은 쪽으로 갱신
+static void search_root(SearchWorker *w)
+{
+    MnkSearch *search = w->search;
+    int player = search->root_player;
+    int empties = w->board.rows * w->board.cols - w->board.filled;
+    for (int depth = 1 + (w->id & 1); depth <= empties; depth++)
+    {
+        int move = -1;
+        int score = negamax(w, player, depth, -MNK_SEARCH_WIN - 1, MNK_SEARCH_WIN + 1, 0, &move);
+        if (atomic_load_explicit(&search->stop, memory_order_relaxed))
+            break;
+
+        pthread_mutex_lock(&search->lock);
+        if (depth > search->best.depth)
+        {
+            search->best.depth = depth;
+            search->best.move = move;
+            search->best.score = score;
+        }
+        pthread_mutex_unlock(&search->lock);
+        // 승패가 정해졌거나 끝까지 읽었으면 더 깊이 볼 필요 없음
+        if (score > MATE_BOUND || score < -MATE_BOUND || depth == empties)
+        {
+            atomic_store_explicit(&search->stop, 1, memory_order_relaxed);
+            break;
+        }
+    }
+}
+
+// 묶음의 스레드 하나: 새 탐색 번호를 기다렸다가 탐색하고, 마지막으로 끝난 스레드가 호출한 쪽을 깨움
+static void *search_thread(void *arg)
+{
+    SearchWorker *w = arg;
+    MnkSearch *search = w->search;
+    uint64_t seen = 0;
+    pthread_mutex_lock(&search->lock);
+    for (;;)
+    {
+        while (search->generation == seen && !search->quit)
+            pthread_cond_wait(&search->start_cond, &search->lock);
+        if (search->quit)
+            break;
+        seen = search->generation;
+        pthread_mutex_unlock(&search->lock);
+        search_root(w);
+        pthread_mutex_lock(&search->lock);
+        if (--search->running == 0)
+            pthread_cond_signal(&search->done_cond);
+    }
+    pthread_mutex_unlock(&search->lock);
+    return NULL;
+}
+
+int mnk_search_best(MnkSearch *search, const MnkBoard *board, int player, int budget_ms, MnkSearchResult *result)
+{
+    uint64_t start = now_ns();
+    if (board->rows != search->rows || board->cols != search->cols || board->k != search->k)
+        setup_geometry(search, board);
+
+    SearchWorker *workers = search->workers;
+    for (int i = 0; i < search->threads; i++)
+        worker_setup(&workers[i], search, i, board);
+
+    // 한 깊이도 못 마치면 후보 순서의 첫 수 (바로 이기는 수나 막아야 할 수가 앞에 옴)
+    int first[MNK_MAX_CELLS];
+    memset(&search->best, 0, sizeof(search->best));
+    search->best.move = generate_moves(&workers[0], player, -1, first) > 0 ? first[0] : -1;
+    if (search->best.move == -1 || mnk_is_full(board))
+        return -1;
+    search->root_player = player;
+    search->deadline_ns = start + (uint64_t)budget_ms * 1000000ull;
+    atomic_store(&search->stop, 0);
+
+    // 묶음의 모든 스레드를 깨우고 모두 끝날 때까지 대기 (호출한 스레드는 탐색하지 않음)
+    pthread_mutex_lock(&search->lock);
+    search->running = search->threads;
+    search->generation++;
+    pthread_cond_broadcast(&search->start_cond);
+    while (search->running > 0)
+        pthread_cond_wait(&search->done_cond, &search->lock);
+    pthread_mutex_unlock(&search->lock);
+
+    search->best.nodes = 0;
+    for (int i = 0; i < search->threads; i++)
+        search->best.nodes += workers[i].nodes;
+    search->best.elapsed_ns = now_ns() - start;
+    *result = search->best;
+    return 0;
+}
@@ -0,0 +1,78 @@
+// mnk_search.h
+// m×n k목 탐색 엔진: 여러 스레드가 치환표 하나를 공유하는 병렬 알파-베타 (Lazy SMP)
+//  스레드마다 같은 국면을 반복 심화로 탐색하고, 홀수 번 스레드는 한 수 더 깊게 시작해서 서로 다른 가지를 먼저 채움
+//  치환표 항목은 잠금 없이 check = key ^ data 로 기록하므로, 두 스레드의 쓰기가 섞인 항목은 조회에서 버려짐
+//  시간 예산이 지나면 모든 스레드를 멈추고 끝까지 마친 가장 깊은 반복의 최선의 수를 돌려줌
+//  수 두기와 승리 판정은 mnk_board 의 규칙(mnk_place, mnk_wins_at)을 그대로 사용
+//  탐색 스레드는 init 에서 한 번 만들어 두고 탐색마다 깨워 씀 (호출마다 스레드를 만들지 않음)
+#ifndef MNK_SEARCH_H
+#define MNK_SEARCH_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include "mnk_board.h"
+
+#define MNK_SEARCH_TT_BITS 18  // 기본 치환표 크기: 2^18 항목 (4MB)
+#define MNK_SEARCH_WIN 1000000000 // 이긴 국면의 점수 (빨리 이길수록 큼)
+#define MNK_SEARCH_MAX_WINDOWS (4 * MNK_MAX_CELLS) // k칸 창의 최대 개수 (방향 4개)
+#define MNK_SEARCH_CELL_WINDOWS (4 * MNK_MAX_SIDE) // 한 칸을 지나는 창의 최대 개수
+
+typedef struct
+{
+    _Atomic uint64_t check; // key ^ data
+    _Atomic uint64_t data;  // 수 + 1(16비트) | 깊이(8비트) | 경계(2비트) | 점수(상위 32비트)
+} MnkTtEntry;
+
+typedef struct
+{
+    int move;            // 최선의 칸 (row * cols + col), 둘 곳이 없으면 -1
+    int score;           // 둘 차례인 쪽 기준 평가값 (MNK_SEARCH_WIN 근처면 강제 승/패)
+    int depth;           // 끝까지 마친 반복 심화 깊이 (0: 한 번도 못 마침, 후보 순서의 첫 수)
+    uint64_t nodes;      // 모든 스레드가 방문한 노드 수
+    uint64_t elapsed_ns;
+} MnkSearchResult;
+
+struct MnkSearchWorker;
+
+typedef struct
+{
+    int threads;
+    MnkTtEntry *table;
+    uint64_t table_mask;
+    uint64_t zobrist[2][MNK_MAX_CELLS];
+    uint64_t side_key; // 플레이어 1 차례일 때 해시에 섞는 값
+    uint64_t base_key; // 빈 게임판의 해시 (0 이 아니어야 빈 항목과 구분됨)
+
+    // 게임판 기하: 크기가 바뀌면 다시 만들고 치환표를 비움
+    int rows, cols, k;
+    int window_count;
+    uint8_t cell_window_count[MNK_MAX_CELLS];
+    uint16_t cell_windows[MNK_MAX_CELLS][MNK_SEARCH_CELL_WINDOWS]; // 칸을 지나는 창 번호
+    int weights[MNK_MAX_SIDE + 1]; // 창 하나에 한 플레이어 돌만 c 개 있을 때의 가치
+
+    // 탐색 한 번 동안 공유하는 상태
+    int root_player;
+    uint64_t deadline_ns;
+    atomic_int stop;
+    pthread_mutex_t lock; // best 갱신, 아래 스레드 묶음 상태
+    MnkSearchResult best;
+
+    // 스레드 묶음: generation 이 바뀌면 모든 스레드가 새 탐색을 시작하고, running 이 0 이 되면 끝
+    struct MnkSearchWorker *workers;
+    pthread_t *thread_ids;
+    pthread_cond_t start_cond, done_cond;
+    uint64_t generation;
+    int running;
+    int quit;
+} MnkSearch;
+
+// 스레드를 threads 개 만듦 (일부만 만들어지면 그만큼으로 탐색), -1: 메모리 부족이거나 스레드를 하나도 못 만듦
+int mnk_search_init(MnkSearch *search, int threads, int tt_bits);
+void mnk_search_destroy(MnkSearch *search);
+void mnk_search_clear(MnkSearch *search); // 치환표 비우기 (새 게임)
+// player 가 둘 차례인 board 에서 budget_ms 동안 탐색, 0: 성공, -1: 둘 곳이 없음
+//  같은 search 로 동시에 부르면 안 됨 (스레드 묶음이 하나)
+int mnk_search_best(MnkSearch *search, const MnkBoard *board, int player, int budget_ms, MnkSearchResult *result);
+
+#endif
@@ -9,60 +9,70 @@
 #include <sys/types.h>
 #include <errno.h>
 #include <time.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "wire.h"
 
 #define MAX_CLIENTS 2
 #define PIPE_READ 0
 #define PIPE_WRITE 1
+#define DEFAULT_SOCKET_PATH "./ttt.sock" // sock_server 기본 소켓 경로
 
 // 클라이언트와 서버 간의 파이프 파일 디스크립터
-int pipe_fd[2];     // [읽기, 쓰기]
+int pipe_fd[2];     // [읽기, 쓰기] (소켓 접속이면 둘 다 같은 소켓)
+WireReader server_reader; // 서버 메시지 재조립 버퍼 (접속 수락 메시지와 이후 메시지가 붙어 올 수 있어 공유)
 int player_id = -1; // 서버로부터 받은 플레이어 ID
 
+int session_id = 0;  // 접속할 세션 ID
+int use_socket = 0;  // 1: sock_server 에 접속 (게임이 끝나도 접속을 유지하고 다시 대기열에 들어갈 수 있음)
+
 // 클라이언트 FIFO 이름과 서버 FIFO 이름을 저장할 변수
-char client_fifo_name[32];
-char server_fifo_name[32];
+char client_fifo_name[256];
+char server_fifo_name[256];
 
 // 뮤텍스
 pthread_cond_t turn_cond = PTHREAD_COND_INITIALIZER;    // 조건 변수
 pthread_mutex_t turn_mutex = PTHREAD_MUTEX_INITIALIZER; // 턴 확인을 위한 뮤텍스
-pthread_mutex_t file_mutex = PTHREAD_MUTEX_INITIALIZER; // 파일 보호를 위한 뮤텍스
 
 // 플래그
 volatile int game_over_flag = 0; // 게임 종료 플래그
 volatile int your_turn = 0;      // 턴 플래그
+volatile int server_closed = 0;  // 서버가 접속을 끊음 (다시 대기열에 들어갈 수 없음)
+
+// 차례 알림 메시지에 담긴 게임판 출력
+void print_board(const WireMessage *msg)
+{
+    static const char symbols[3] = {' ', 'X', 'O'};
+    printf("\n=== Game Board ===\n");
+    printf("Turn:%d\n", msg->turn);
+    for (int i = 0; i < msg->rows; i++)
+    {
+        for (int j = 0; j < msg->cols; j++)
+        {
+            int cell = msg->cells[i * msg->cols + j];
+            printf(j == 0 ? "%c" : "|%c", (cell >= MNK_EMPTY && cell <= 1) ? symbols[cell + 1] : '?');
+        }
+        printf("\n");
+    }
+}
 
 // 서버 메시지 수신 및 처리 스레드용 함수
 void *listen_server(void *arg)
 {
-    char buffer[256];
+    (void)arg;
+    WireReader *reader = &server_reader; // read 한 번에 여러 프레임이 붙어 오거나 잘려 와도 재조립
+    WireMessage msg;
     printf("클라이언트 %d의 수신 스레드 정상 작동.\n", player_id);
     fflush(stdout);
     while (!game_over_flag)
     {
-        int n = read(pipe_fd[PIPE_READ], buffer, sizeof(buffer));
+        int n = wire_recv(reader, pipe_fd[PIPE_READ], &msg);
         if (n > 0)
         {
-            buffer[n] = '\0'; // 문자열 종료
-            if (strncmp(buffer, "Your Turn", 9) == 0)
+            if (msg.type == WIRE_YOUR_TURN)
             {
-                // 차례 시작
-                pthread_mutex_lock(&file_mutex);
-                // readme.txt에서 게임판 읽기
-                FILE *fp = fopen("readme.txt", "r");
-                if (fp == NULL)
-                {
-                    perror("Failed to open readme.txt");
-                    pthread_mutex_unlock(&file_mutex);
-                    continue;
-                }
-                char line[256];
-                printf("\n=== Game Board ===\n");
-                while (fgets(line, sizeof(line), fp))
-                {
-                    printf("%s", line);
-                }
-                fclose(fp);
-                pthread_mutex_unlock(&file_mutex);
+                // 차례 시작: 메시지에 담긴 게임판 출력
+                print_board(&msg);
 
                 // 조건 변수 신호를 보내어 입력 스레드가 입력을 받도록 함
                 pthread_mutex_lock(&turn_mutex);
@@ -73,10 +83,13 @@ void *listen_server(void *arg)
                 printf("**서버> 당신의 차례**.\n"); // 로그 메시지
                 fflush(stdout);
             }
-            else if (strncmp(buffer, "Game Over", 9) == 0)
+            else if (msg.type == WIRE_GAME_OVER)
             {
                 // 게임 종료
-                printf("**경기 결과**: %s\n", buffer);
+                if (msg.winner == 2)
+                    printf("**경기 결과**: 무승부\n");
+                else
+                    printf("**경기 결과**: 승자 플레이어 %d\n", msg.winner);
                 printf("**자리를 치웁니다**\n");
                 fflush(stdout);
                 game_over_flag = 1;
@@ -86,13 +99,16 @@ void *listen_server(void *arg)
                 pthread_cond_signal(&turn_cond);
                 pthread_mutex_unlock(&turn_mutex);
 
-                // 파이프 닫기
-                close(pipe_fd[PIPE_READ]);
-                close(pipe_fd[PIPE_WRITE]);
+                // 파이프 닫기 (소켓은 다시 대기열에 들어갈 수 있으므로 main 에서 닫음)
+                if (!use_socket)
+                {
+                    close(pipe_fd[PIPE_READ]);
+                    close(pipe_fd[PIPE_WRITE]);
+                }
 
                 break; // 스레드 종료
             }
-            else if (strncmp(buffer, "Invalid Move", 12) == 0)
+            else if (msg.type == WIRE_INVALID_MOVE)
             {
                 // 잘못된 수
                 printf("**말을 다시 놓으세요**\n");
@@ -101,7 +117,7 @@ void *listen_server(void *arg)
             else
             {
                 // 기타 메시지 처리
-                printf("**이상한 말이 나옴 오류: %s\n", buffer);
+                printf("**이상한 말이 나옴 오류: 메시지 종류 %d\n", msg.type);
                 fflush(stdout);
             }
         }
@@ -111,6 +127,7 @@ void *listen_server(void *arg)
             printf("**서버와의 파이프 연결이 종료됩니다**\n");
             fflush(stdout);
             game_over_flag = 1;
+            server_closed = 1;
 
             // 모든 스레드가 종료되도록 조건 변수 신호
             pthread_mutex_lock(&turn_mutex);
@@ -119,9 +136,17 @@ void *listen_server(void *arg)
 
             break; // 스레드 종료
         }
+        else if (n == WIRE_CORRUPT)
+        {
+            // 프레임 경계를 잃어버림: 버퍼를 비우고 다음 메시지부터 다시 받음
+            printf("**손상된 메시지 수신, 버림**\n");
+            fflush(stdout);
+            wire_reader_init(reader);
+        }
         else
         {
             perror("read failed");
+            server_closed = 1;
             break; // 스레드 종료
         }
     }
@@ -133,6 +158,7 @@ void *listen_server(void *arg)
 // 사용자 입력을 처리하는 스레드용 함수
 void *input_handler(void *arg)
 {
+    (void)arg;
     printf("**클라이언트 %d의 입력 스레드 정상 작동**\n", player_id);
     fflush(stdout);
     while (!game_over_flag)
@@ -222,10 +248,12 @@ void *input_handler(void *arg)
         printf("입력 시간: %.3f seconds\n", elapsed);
         fflush(stdout);
 
-        // 서버로 수 전송 (row, col, elapsed_time)
-        char buffer[256];
-        snprintf(buffer, sizeof(buffer), "%d %d %.3f", row, col, elapsed);
-        if (write(pipe_fd[PIPE_WRITE], buffer, strlen(buffer) + 1) == -1)
+        // 서버로 수 전송 (row, col, 입력 시간)
+        WireMessage move = {.type = WIRE_MOVE, .session = session_id, .player = player_id, .row = row, .col = col};
+        move.think_ns = (uint64_t)(end_time.tv_sec - start_time.tv_sec) * 1000000000ull +
+                        (uint64_t)(end_time.tv_nsec - start_time.tv_nsec);
+        move.timestamp_ns = wire_now_ns();
+        if (wire_send(pipe_fd[PIPE_WRITE], &move) == -1)
         {
             perror("write to server failed");
             continue;
@@ -239,6 +267,7 @@ void *input_handler(void *arg)
 // 상태 모니터링 스레드용 함수
 void *status_monitor(void *arg)
 {
+    (void)arg;
     // 속도 동기화용
     printf("**클라이언트 %d의 모니터링 스레드 정상 작동**\n", player_id);
     fflush(stdout);
@@ -251,34 +280,41 @@ void *status_monitor(void *arg)
     pthread_exit(NULL);
 }
 
-// 메인 함수, 스레드
-int main(int argc, char *argv[])
+// 세션/플레이어 ID에 해당하는 FIFO 열기 (인자: <player_id> [session_id] [fifo_dir])
+static int open_fifos(int argc, char *argv[])
 {
-    // 인자 검사: 플레이어 ID (0 또는 1) 필요
-    if (argc != 2)
-    {
-        fprintf(stderr, "Usage: %s <player_id (0 or 1)>\n", argv[0]);
-        // 클라이언트 프로세스 실행 시 ./pipe_client 0 또는 ./pipe_client 1로 실행
-        exit(EXIT_FAILURE);
-    }
-
     player_id = atoi(argv[1]);
     if (player_id < 0 || player_id >= MAX_CLIENTS)
     {
         fprintf(stderr, "Invalid player_id. Must be 0 or 1.\n");
-        exit(EXIT_FAILURE);
+        return -1;
     }
 
-    // 플레이어 ID에 따른 FIFO 이름 설정
-    snprintf(client_fifo_name, sizeof(client_fifo_name), "client%d_fifo", player_id);
-    snprintf(server_fifo_name, sizeof(server_fifo_name), "server%d_fifo", player_id);
+    const char *dir = ".";
+    if (argc >= 3)
+    {
+        session_id = atoi(argv[2]);
+        if (session_id < 0)
+        {
+            fprintf(stderr, "Invalid session_id.\n");
+            return -1;
+        }
+    }
+    if (argc >= 4)
+    {
+        dir = argv[3];
+    }
+
+    // 세션 ID와 플레이어 ID에 따른 FIFO 이름 설정
+    snprintf(client_fifo_name, sizeof(client_fifo_name), "%s/s%d_client%d_fifo", dir, session_id, player_id);
+    snprintf(server_fifo_name, sizeof(server_fifo_name), "%s/s%d_server%d_fifo", dir, session_id, player_id);
 
     // 서버로 접속 알림을 위해 FIFO 열기
     pipe_fd[PIPE_WRITE] = open(client_fifo_name, O_WRONLY);
     if (pipe_fd[PIPE_WRITE] == -1)
     {
         perror("Failed to open client FIFO for writing");
-        exit(EXIT_FAILURE);
+        return -1;
     }
 
     // 서버로부터 메시지 수신을 위한 FIFO 열기
@@ -287,10 +323,82 @@ int main(int argc, char *argv[])
     {
         perror("Failed to open server FIFO for reading");
         close(pipe_fd[PIPE_WRITE]);
-        exit(EXIT_FAILURE);
+        return -1;
+    }
+    return 0;
+}
+
+// 대기열 입장 알림 후 상대가 오면 세션/플레이어 배정 알림
+static int wait_for_match(int fd)
+{
+    WireMessage msg;
+    for (;;)
+    {
+        if (wire_recv(&server_reader, fd, &msg) != 1 || msg.type != WIRE_WELCOME)
+            return -1;
+        if (msg.session != WIRE_LOBBY_SESSION)
+            break;
+        printf("<대기열에서 상대를 기다리는 중...>\n");
+        fflush(stdout);
     }
+    player_id = msg.player;
+    session_id = msg.session;
+    return 0;
+}
+
+// sock_server 에 접속하고 접속 수락 메시지로 플레이어/세션 ID를 받음
+static int connect_socket(const char *path)
+{
+    struct sockaddr_un addr = {.sun_family = AF_UNIX};
+    snprintf(addr.sun_path, sizeof(addr.sun_path), "%s", path);
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd == -1 || connect(fd, (struct sockaddr *)&addr, sizeof(addr)) == -1)
+    {
+        perror("Failed to connect to server socket");
+        if (fd != -1)
+            close(fd);
+        return -1;
+    }
+
+    pipe_fd[PIPE_READ] = fd;
+    pipe_fd[PIPE_WRITE] = fd;
+    if (wait_for_match(fd) == -1)
+    {
+        fprintf(stderr, "Server did not accept the connection.\n");
+        close(fd);
+        return -1;
+    }
+    return 0;
+}
+
+// 게임이 끝난 뒤 WIRE_REQUEUE 로 다시 대기열에 들어가 다음 상대를 기다림
+static int requeue_socket(void)
+{
+    WireMessage requeue = {.type = WIRE_REQUEUE, .session = session_id, .player = player_id};
+    requeue.timestamp_ns = wire_now_ns();
+    if (wire_send(pipe_fd[PIPE_WRITE], &requeue) == -1 || wait_for_match(pipe_fd[PIPE_READ]) == -1)
+    {
+        fprintf(stderr, "Server did not put the connection back in the queue.\n");
+        return -1;
+    }
+    game_over_flag = 0;
+    your_turn = 0;
+    return 0;
+}
+
+// 한 판 더 둘지 물어봄 (y: 다시 대기열로, 그 밖의 입력이나 EOF: 종료)
+static int ask_play_again(void)
+{
+    char answer[16];
+    printf("다시 두시겠습니까? [y/n]: ");
+    fflush(stdout);
+    return fgets(answer, sizeof(answer), stdin) != NULL && (answer[0] == 'y' || answer[0] == 'Y');
+}
 
-    printf("<플레이어 %d 서버에 접속>\n", player_id);
+// 게임 한 판: 수신, 입력, 모니터 스레드를 띄우고 모두 끝날 때까지 대기
+static void play_game(void)
+{
+    printf("<플레이어 %d 세션 %d 서버에 접속>\n", player_id, session_id);
     fflush(stdout);
 
     // 서버로부터 메시지 수신 스레드 시작
@@ -317,13 +425,48 @@ int main(int argc, char *argv[])
         exit(EXIT_FAILURE);
     }
 
-    // 메인 스레드는 리스너, 입력, 모니터 스레드가 종료될 때까지 대기
+    // 리스너, 입력, 모니터 스레드가 종료될 때까지 대기
     pthread_join(listener_thread, NULL);
     pthread_join(input_thread, NULL);
     pthread_join(monitor_thread, NULL);
+}
+
+// 메인 함수, 스레드
+int main(int argc, char *argv[])
+{
+    // 인자 검사: 플레이어 ID (0 또는 1) 필요, 세션 ID와 FIFO 디렉터리는 선택
+    //  -u [소켓 경로]: sock_server 에 접속 (플레이어/세션 ID는 서버가 배정, 게임이 끝나면 다시 대기열에 들어갈 수 있음)
+    if (argc < 2 || argc > 4)
+    {
+        fprintf(stderr, "Usage: %s <player_id (0 or 1)> [session_id] [fifo_dir]\n", argv[0]);
+        fprintf(stderr, "       %s -u [socket_path]\n", argv[0]);
+        // 클라이언트 프로세스 실행 시 ./pipe_client 0 또는 ./pipe_client 1로 실행
+        exit(EXIT_FAILURE);
+    }
+    wire_reader_init(&server_reader);
+
+    if (strcmp(argv[1], "-u") == 0)
+    {
+        use_socket = 1;
+        if (connect_socket(argc >= 3 ? argv[2] : DEFAULT_SOCKET_PATH) == -1)
+            exit(EXIT_FAILURE);
+    }
+    else if (open_fifos(argc, argv) == -1)
+    {
+        exit(EXIT_FAILURE);
+    }
+
+    // 소켓 접속: 게임이 끝나면 한 판 더 둘지 물어보고, 원하면 같은 접속으로 다시 대기열에 들어감
+    for (;;)
+    {
+        play_game();
+        if (!use_socket || server_closed || !ask_play_again() || requeue_socket() == -1)
+            break;
+    }
+    if (use_socket)
+        close(pipe_fd[PIPE_READ]);
 
     // 리소스 정리
-    pthread_mutex_destroy(&file_mutex);
     pthread_cond_destroy(&turn_cond);
     pthread_mutex_destroy(&turn_mutex);
 
@@ -3,452 +3,188 @@
 #include <stdlib.h>
 #include <pthread.h>
 #include <unistd.h>
-#include <fcntl.h>
 #include <string.h>
-#include <sys/stat.h>
-#include <sys/types.h>
-#include <errno.h>
-#include <time.h>
-#include <semaphore.h>
+#include <signal.h>
+#include "pipe_session.h"
+#include "stats.h"
+#include "journal.h"
 
-#define MAX_CLIENTS 2 // 최대 클라이언트 수
-#define BOARD_SIZE 3  // 게임판 크기
-#define SEM_NAME_FORMAT "/sem_player_%d"
-#define PIPE_READ 0  // 파이프 인덱스
-#define PIPE_WRITE 1 // 파이프 인덱스
+#define SESSION_STACK_SIZE (256 * 1024) // 세션 스레드 스택 크기 (세션 수가 많을 때 메모리 절약)
 
-typedef struct // 게임 상태 구조체
+static void usage(const char *prog)
 {
-    char board[BOARD_SIZE][BOARD_SIZE];
-    int turn;   // 현재 턴인 플레이어 ID (0 또는 1)
-    int winner; // -1: 게임 진행 중, 0 또는 1: 승자, 2: 무승부
-} GameState;
-
-typedef struct // 클라이언트 정보 구조체
-{
-    int id;
-    int pipe_fd[2]; // [읽기, 쓰기]
-    char sem_name[64];
-    sem_t *turn_sem;
-} ClientInfo;
-
-// 전역 변수 정의
-GameState game;
-pthread_mutex_t game_mutex = PTHREAD_MUTEX_INITIALIZER;             // 게임 상태 보호를 위한 뮤텍스
-pthread_mutex_t file_mutex = PTHREAD_MUTEX_INITIALIZER;             // 파일 접근 보호를 위한 뮤텍스
-ClientInfo clients[MAX_CLIENTS];                                    // 클라이언트 정보 배열
-int client_count = 0;                                               // 현재 클라이언트 수
-char *fifo_names[MAX_CLIENTS] = {"client0_fifo", "client1_fifo"};   // 클라이언트 FIFO 이름
-char *server_fifos[MAX_CLIENTS] = {"server0_fifo", "server1_fifo"}; // 서버 FIFO 이름
-struct timespec game_start_time, game_end_time;                     // 게임 시작 및 종료 시간
-double input_times[MAX_CLIENTS] = {0.0};                            // 클라이언트별 입력 시간
-volatile int game_over_flag = 0;                                    // 게임 종료 플래그
-
-// 게임 초기화 함수
-void init_game(GameState *game)
-{
-    for (int i = 0; i < BOARD_SIZE; i++)
-        for (int j = 0; j < BOARD_SIZE; j++)
-            game->board[i][j] = ' ';
-    game->turn = 0;
-    game->winner = -1;
+    fprintf(stderr, "Usage: %s [-s num_sessions] [-d fifo_dir] [-b ROWSxCOLS] [-k k] [-w workers] [-a bot_player] [-m think_ms] [-j journal] [-f state_file]\n", prog);
+    fprintf(stderr, "  예) %s -s 4 -b 15x15 -k 5   (15x15 오목 4판)\n", prog);
+    fprintf(stderr, "  -w: 작업자 풀 크기 (기본: CPU 수, 0: 클라이언트마다 스레드)\n");
+    fprintf(stderr, "  -a: 서버 봇이 두는 플레이어 (0 또는 1, 사람은 나머지 한 명)\n");
+    fprintf(stderr, "      3x3 3목은 미리 푼 표로 완벽하게, 더 큰 게임판은 모든 코어로 병렬 알파-베타 탐색\n");
+    fprintf(stderr, "  -m: 큰 게임판에서 서버 봇의 수당 탐색 시간 (ms, 기본: %d)\n", SESSION_BOT_THINK_MS);
+    fprintf(stderr, "  -j: 모든 수와 결과를 이진 기록 파일에 남김 (./ttt-replay 로 다시 검증)\n");
+    fprintf(stderr, "  -f: 수마다 게임 상태를 저장하는 파일, 서버가 죽은 뒤 같은 옵션으로 다시 켜면 진행 중이던 게임을 이어 둠\n");
+    fprintf(stderr, "      (클라이언트는 같은 세션 번호로 다시 접속, 모든 게임이 끝나면 파일을 지움)\n");
+    fprintf(stderr, "  실행 중 kill -USR1 <pid> 로 끝난 게임들의 시간 분포(입력, IPC, 서버 처리) 출력\n");
+    exit(EXIT_FAILURE);
 }
 
-// 승리 조건 체크 함수
-int check_winner(GameState *game)
+// SIGUSR1 을 받을 때마다 시간 분포 출력 (다른 스레드는 모두 SIGUSR1 을 막아 두어 이 스레드만 받음)
+static void *timing_reporter(void *arg)
 {
-    // 틱택토의 승리 조건
-    //  가로, 세로, 대각선 중 한 줄이라도 같은 문자열이면 승리
-    //  가로, 세로, 대각선 체크
-    for (int i = 0; i < BOARD_SIZE; i++)
-    {
-        // 가로
-        if (game->board[i][0] != ' ' &&
-            game->board[i][0] == game->board[i][1] &&
-            game->board[i][1] == game->board[i][2])
-        {
-            printf("플레이어 %d 승리, 가로줄 %d!\n", game->board[i][0] == 'X' ? 0 : 1, i);
-            fflush(stdout);
-            return game->board[i][0] == 'X' ? 0 : 1;
-        }
-
-        // 세로
-        if (game->board[0][i] != ' ' &&
-            game->board[0][i] == game->board[1][i] &&
-            game->board[1][i] == game->board[2][i])
-        {
-            printf("플레이어 %d 승리, 세로줄 %d!\n", game->board[0][i] == 'X' ? 0 : 1, i);
-            fflush(stdout);
-            return game->board[0][i] == 'X' ? 0 : 1;
-        }
-    }
-
-    // 대각선
-    if (game->board[0][0] != ' ' &&
-        game->board[0][0] == game->board[1][1] &&
-        game->board[1][1] == game->board[2][2])
-    {
-        printf("플레이어 %d 승리, 대각선!\n", game->board[0][0] == 'X' ? 0 : 1);
-        fflush(stdout);
-        return game->board[0][0] == 'X' ? 0 : 1;
-    }
-
-    if (game->board[0][2] != ' ' &&
-        game->board[0][2] == game->board[1][1] &&
-        game->board[1][1] == game->board[2][0])
-    {
-        printf("플레이어 %d 승리, 대각선!\n", game->board[0][2] == 'X' ? 0 : 1);
-        fflush(stdout);
-        return game->board[0][2] == 'X' ? 0 : 1;
-    }
-
-    return -1; // 아직 승자가 없음
+    SessionTable *table = (SessionTable *)arg;
+    sigset_t set;
+    sigemptyset(&set);
+    sigaddset(&set, SIGUSR1);
+    int sig;
+    while (sigwait(&set, &sig) == 0)
+        session_table_report(table);
+    return NULL;
 }
 
-// 무승부 체크 함수
-int is_draw(GameState *game)
+int main(int argc, char *argv[])
 {
-    for (int i = 0; i < BOARD_SIZE; i++)
-        for (int j = 0; j < BOARD_SIZE; j++)
-            if (game->board[i][j] == ' ')
-                return 0; // 아직 빈 공간 있음
-    printf("무승부\n");
-    fflush(stdout);
-    return 1; // 무승부
-}
-
-// 수를 두는 함수
-int make_move(GameState *game, int player_id, int row, int col)
-{
-    if (row < 0 || row >= BOARD_SIZE || col < 0 || col >= BOARD_SIZE)
-        return -1; // 잘못된 좌표
-    if (game->board[row][col] != ' ')
-        return -1; // 이미 수가 존재함
-    game->board[row][col] = (player_id == 0) ? 'X' : 'O';
-    return 0; // 성공
-}
-
-// 게임 모니터링 스레드
-void *game_monitor(void *arg)
-{
-    printf("**게임 시작 알림**\n");
-    fflush(stdout);
-
-    while (!game_over_flag)
-    {
-        // 게임 상태 확인
-        pthread_mutex_lock(&game_mutex);
-        game.winner = check_winner(&game);
-        if (game.winner != -1 || is_draw(&game))
-        {
-            game_over_flag = 1;
-            pthread_mutex_unlock(&game_mutex);
+    uint64_t launched = stats_now_ns(); // 재시작부터 접속 대기까지의 시간 측정
+    // 세션 설정 (기본: 세션 1개, 현재 디렉터리, 3x3 3목)
+    SessionConfig config;
+    session_config_default(&config);
+    config.stack_size = SESSION_STACK_SIZE;
+    config.workers = work_pool_cpus(); // 스레드 수가 세션 수와 무관하도록 코어마다 작업자 하나
+    const char *journal_path = NULL;
+    const char *state_path = NULL;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "s:d:b:k:w:a:m:j:f:")) != -1)
+    {
+        switch (opt)
+        {
+        case 's':
+            config.count = atoi(optarg);
             break;
-        }
-        pthread_mutex_unlock(&game_mutex);
-
-        // 잠시 대기
-        sleep(1);
-    }
-
-    printf("**모니터링 결과 게임 종료**\n");
-    fflush(stdout);
-
-    // 게임 종료 메시지 전송 및 세마포어 해제
-    char buffer[256];
-    snprintf(buffer, sizeof(buffer), "Game Over|Winner:%d", game.winner);
-    for (int i = 0; i < MAX_CLIENTS; i++)
-    {
-        if (write(clients[i].pipe_fd[PIPE_WRITE], buffer, strlen(buffer) + 1) == -1)
-        {
-            perror("write to client failed");
-        }
-        // 파이프 닫기
-        close(clients[i].pipe_fd[PIPE_WRITE]);
-
-        // 세마포어 해제
-        if (sem_post(clients[i].turn_sem) == -1)
-        {
-            perror("sem_post failed");
-        }
-    }
-
-    pthread_exit(NULL);
-}
-
-// 클라이언트 핸들러 함수
-void *client_handler(void *arg)
-{
-    ClientInfo *client = (ClientInfo *)arg;
-    printf("**클라이언트 %d의 스레드 연결 확인**\n", client->id);
-    fflush(stdout);
-    char buffer[256];
-
-    while (!game_over_flag)
-    {
-        // 차례 대기
-        if (sem_wait(client->turn_sem) == -1)
-        {
-            perror("sem_wait failed");
+        case 'd':
+            config.dir = optarg;
             break;
-        }
-
-        if (game_over_flag)
-        {
+        case 'b':
+            if (sscanf(optarg, "%dx%d", &config.rows, &config.cols) != 2)
+                usage(argv[0]);
             break;
-        }
-
-        // 현재 게임판 및 차례 알림
-        pthread_mutex_lock(&file_mutex);
-        FILE *fp = fopen("readme.txt", "w");
-        if (fp == NULL)
-        {
-            perror("Failed to open readme.txt");
-            pthread_mutex_unlock(&file_mutex);
-            continue;
-        }
-        fprintf(fp, "Turn:%d\n", game.turn); // 정확한 턴 정보 기록
-        for (int i = 0; i < BOARD_SIZE; i++)
-        {
-            fprintf(fp, "%c|%c|%c\n", game.board[i][0], game.board[i][1], game.board[i][2]);
-        }
-        fclose(fp);
-        pthread_mutex_unlock(&file_mutex);
-
-        // 차례 시작 알림
-        snprintf(buffer, sizeof(buffer), "Your Turn");
-        if (write(client->pipe_fd[PIPE_WRITE], buffer, strlen(buffer) + 1) == -1)
-        {
-            perror("write Your Turn to client failed");
-            continue;
-        }
-
-        // 현재 플레이어의 턴임을 서버 콘솔에 출력
-        printf("플레이어 %d의 턴.\n", client->id);
-        fflush(stdout); // 즉시 출력
-
-        // 클라이언트의 수 입력 대기
-        int n = read(client->pipe_fd[PIPE_READ], buffer, sizeof(buffer));
-        if (n > 0)
-        {
-            int row, col;
-            double elapsed_time;
-            // 클라이언트가 "row col elapsed_time" 형식으로 전송
-            if (sscanf(buffer, "%d %d %lf", &row, &col, &elapsed_time) != 3)
-            {
-                fprintf(stderr, "Invalid input format from client %d.\n", client->id);
-                fflush(stderr);
-                snprintf(buffer, sizeof(buffer), "Invalid Move");
-                if (write(client->pipe_fd[PIPE_WRITE], buffer, strlen(buffer) + 1) == -1)
-                {
-                    perror("write Invalid Move to client failed");
-                }
-                // 현재 클라이언트의 세마포어 다시 해제
-                if (sem_post(client->turn_sem) == -1)
-                {
-                    perror("sem_post failed");
-                }
-                continue;
-            }
-
-            // 입력 시간 누적
-            input_times[client->id] += elapsed_time;
-
-            pthread_mutex_lock(&game_mutex);
-            if (make_move(&game, client->id, row, col) == 0)
-            {
-                // 다음 차례로 전환
-                game.turn = 1 - game.turn;
-                pthread_mutex_unlock(&game_mutex);
-
-                // 다음 플레이어의 세마포어 해제
-                if (sem_post(clients[game.turn].turn_sem) == -1)
-                {
-                    perror("sem_post failed");
-                }
-            }
-            else
-            {
-                // 잘못된 수, 다시 시도 요청
-                pthread_mutex_unlock(&game_mutex);
-                snprintf(buffer, sizeof(buffer), "Invalid Move");
-                if (write(client->pipe_fd[PIPE_WRITE], buffer, strlen(buffer) + 1) == -1)
-                {
-                    perror("write Invalid Move to client failed");
-                }
-                // 현재 클라이언트의 세마포어 다시 해제
-                if (sem_post(client->turn_sem) == -1)
-                {
-                    perror("sem_post failed");
-                }
-            }
-        }
-        else if (n == 0)
-        {
-            // 파이프가 닫혔을 때
-            printf("**클라이언트 %d의 파이프 연결 종료\n", client->id);
-            fflush(stdout);
-            break; // 스레드 종료
-        }
-        else
-        {
-            perror("read failed");
-            break; // 스레드 종료
+        case 'k':
+            config.k = atoi(optarg);
+            break;
+        case 'w':
+            config.workers = atoi(optarg);
+            break;
+        case 'a':
+            config.bot_player = atoi(optarg);
+            if (config.bot_player < 0 || config.bot_player >= MAX_CLIENTS)
+                usage(argv[0]);
+            break;
+        case 'm':
+            config.bot_think_ms = atoi(optarg);
+            if (config.bot_think_ms <= 0)
+                usage(argv[0]);
+            break;
+        case 'j':
+            journal_path = optarg;
+            break;
+        case 'f':
+            state_path = optarg;
+            break;
+        default:
+            usage(argv[0]);
         }
     }
-    printf("**클라이언트 %d과 스레드 연결 종료**\n", client->id);
-    fflush(stdout);
-    pthread_exit(NULL);
-}
-
-int main()
-{
-    // 게임 초기화
-    init_game(&game);
-
-    // 기존 FIFO 파일 제거 후 생성
-    for (int i = 0; i < MAX_CLIENTS; i++)
+    if (config.count <= 0 || config.workers < 0 || optind != argc)
     {
-        unlink(fifo_names[i]); // 기존 FIFO 파일 제거
-        unlink(server_fifos[i]);
-        if (mkfifo(fifo_names[i], 0666) == -1)
-        {
-            perror("Failed to create client FIFO");
-            exit(EXIT_FAILURE);
-        }
-        if (mkfifo(server_fifos[i], 0666) == -1)
-        {
-            perror("Failed to create server FIFO");
-            exit(EXIT_FAILURE);
-        }
+        usage(argv[0]);
     }
 
-    printf("**서버> 클라이언트 대기 중...**\n");
-    fflush(stdout);
-
-    // 클라이언트 접속 대기
-    while (client_count < MAX_CLIENTS)
+    // 상태 파일: 같은 설정으로 저장된 파일이 있으면 init 에서 세션마다 불러와 이어 둠
+    StateFile state = {0};
+    if (state_path != NULL)
     {
-        // 클라이언트 ID에 따라 FIFO 열기
-        int id = client_count;
-        int fd_read = open(fifo_names[id], O_RDONLY);
-        if (fd_read == -1)
-        {
-            perror("Failed to open client FIFO for reading");
-            continue;
-        }
-        int fd_write = open(server_fifos[id], O_WRONLY);
-        if (fd_write == -1)
-        {
-            perror("Failed to open server FIFO for writing");
-            close(fd_read);
-            continue;
-        }
-
-        // 세마포어 이름 설정
-        snprintf(clients[id].sem_name, sizeof(clients[id].sem_name), SEM_NAME_FORMAT, id);
-        // 세마포어 초기화 (이름 있는 세마포어)
-        clients[id].turn_sem = sem_open(clients[id].sem_name, O_CREAT, 0644, 0);
-        if (clients[id].turn_sem == SEM_FAILED)
-        {
-            perror("Failed to open semaphore");
-            close(fd_read);
-            close(fd_write);
-            continue;
-        }
-
-        // 클라이언트 정보 설정
-        clients[id].id = id;
-        clients[id].pipe_fd[PIPE_READ] = fd_read;
-        clients[id].pipe_fd[PIPE_WRITE] = fd_write;
-
-        client_count++;
-        printf("**클라이언트 %d 접속**\n", id);
-        fflush(stdout);
+        if (state_open(&state, state_path, "pipe_server", config.count, config.rows, config.cols, config.k) == -1)
+            exit(EXIT_FAILURE);
+        config.state = &state;
     }
 
-    // 게임 시작 시간 기록 (두 클라이언트가 연결된 시점)
-    clock_gettime(CLOCK_MONOTONIC, &game_start_time);
+    // 이후 만드는 모든 스레드가 물려받도록 SIGUSR1 을 가장 먼저 막음
+    //  (session_table_init 이 서버 봇의 탐색 스레드를 만들므로 그보다 앞에서)
+    sigset_t report_set;
+    sigemptyset(&report_set);
+    sigaddset(&report_set, SIGUSR1);
+    pthread_sigmask(SIG_BLOCK, &report_set, NULL);
 
-    // 게임 모니터링 스레드 생성
-    pthread_t monitor_thread;
-    if (pthread_create(&monitor_thread, NULL, game_monitor, NULL) != 0)
+    // 세션 테이블 초기화 (세션별 FIFO, 세마포어 생성)
+    SessionTable table;
+    if (session_table_init(&table, &config) == -1)
     {
-        perror("Failed to create game monitor thread");
+        session_table_destroy(&table);
+        state_close(&state);
         exit(EXIT_FAILURE);
     }
 
-    // 첫 번째 플레이어의 세마포어 해제 (선공)
-    if (sem_post(clients[0].turn_sem) == -1)
+    // 통계 세그먼트: 실행 중에 ./ttt-stats 로 확인
+    stats_open(STATS_NAME_PIPE, "pipe_server");
+    if (journal_path != NULL &&
+        journal_open(journal_path, "pipe_server", config.rows, config.cols, config.k, JOURNAL_CAPACITY) == -1)
     {
-        perror("sem_post failed");
+        session_table_destroy(&table);
+        state_close(&state);
+        stats_close();
+        exit(EXIT_FAILURE);
     }
 
-    // 클라이언트별로 스레드 생성 (클라이언트 핸들러 스레드)
-    pthread_t client_threads[MAX_CLIENTS];
-    for (int i = 0; i < MAX_CLIENTS; i++)
-    {
-        if (pthread_create(&client_threads[i], NULL, client_handler, &clients[i]) != 0)
-        {
-            perror("Failed to create client handler thread");
-            exit(EXIT_FAILURE);
-        }
-    }
+    printf("**서버> %d개 세션 (%dx%d, %d목), 클라이언트 대기 중...**\n",
+           config.count, config.rows, config.cols, config.k);
+    if (config.workers > 0)
+        printf("**서버> 작업자 %d개 + 이벤트 대기 스레드 1개로 처리**\n", config.workers);
+    if (config.bot_player != -1)
+        printf("**서버> 플레이어 %d은 서버 봇이 둠 (클라이언트는 플레이어 %d로 접속)**\n", config.bot_player,
+               1 - config.bot_player);
+    fflush(stdout);
 
-    // 게임 모니터링 스레드가 게임 종료를 감지할 때까지 대기
-    pthread_join(monitor_thread, NULL);
+    // SIGUSR1 을 기다리는 출력 스레드 시작 (나머지 스레드는 모두 막은 채로 만들어짐)
+    pthread_t reporter;
+    if (pthread_create(&reporter, NULL, timing_reporter, &table) == 0)
+        pthread_detach(reporter);
 
-    // 모든 클라이언트 핸들러 스레드가 종료될 때까지 대기
-    for (int i = 0; i < MAX_CLIENTS; i++)
+    // 세션별 접속 대기 및 게임 진행
+    if (session_table_start(&table) == -1)
     {
-        pthread_join(client_threads[i], NULL);
+        session_table_destroy(&table);
+        journal_close();
+        stats_close();
+        state_close(&state);
+        exit(EXIT_FAILURE);
     }
-
-    // 게임 종료 시간 기록
-    clock_gettime(CLOCK_MONOTONIC, &game_end_time);
-
-    // 전체 실행 시간 계산
-    double total_runtime = (game_end_time.tv_sec - game_start_time.tv_sec) +
-                           (game_end_time.tv_nsec - game_start_time.tv_nsec) / 1e9;
-
-    // 입력 시간 합계 계산
-    double total_input_time = 0.0;
-    for (int i = 0; i < MAX_CLIENTS; i++)
+    if (state_path != NULL)
     {
-        total_input_time += input_times[i];
+        printf("**서버> 상태 파일에서 진행 중인 게임 %d개를 이어 둠, 시작부터 접속 대기까지 %.3f ms**\n",
+               table.resumed, (stats_now_ns() - launched) / 1e6);
+        fflush(stdout);
     }
 
+    // 모든 세션의 게임이 끝날 때까지 대기
+    session_table_join(&table);
+
     // 결과 출력
-    printf("**게임 종료**\n");
-    if (game.winner == 2 || game.winner == -1)
+    for (int s = 0; s < table.count; s++)
     {
-        printf("**결과: 무승부**\n");
+        session_print_result(&table.sessions[s]);
     }
-    else
-    {
-        printf("**결과: 플레이어 %d 승리!**\n", game.winner);
-    }
-
-    // 시간 출력
-    // 게임 실행 시간, 입력 시간, 프로세스 구동 시간(실행 시간 - 입력 시간)
-    printf("1. 게임 실행 시간: %.3f seconds\n", total_runtime);
-    printf("2. 사용자 입력 시간: %.3f seconds\n", total_input_time);
-    printf("3. 프로그램 구동 시간: %.3f seconds\n", total_runtime - total_input_time);
+    session_table_report(&table);
 
     // 리소스 정리
-    pthread_mutex_destroy(&game_mutex);
-    pthread_mutex_destroy(&file_mutex);
-    for (int i = 0; i < MAX_CLIENTS; i++)
+    session_table_destroy(&table);
+    journal_close();
+    stats_close();
+    if (state_path != NULL)
     {
-        sem_close(clients[i].turn_sem);
-        sem_unlink(clients[i].sem_name);
-        close(clients[i].pipe_fd[PIPE_READ]);
-        unlink(fifo_names[i]);
-        unlink(server_fifos[i]);
+        // 모든 게임이 끝났으므로 이어 둘 것이 없음
+        state_close(&state);
+        unlink(state_path);
     }
 
     printf("**서버 종료**.\n");
     fflush(stdout);
 
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,1238 @@
+// pipe_session.c
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <errno.h>
+#include <time.h>
+#include <semaphore.h>
+#include <stddef.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include "pipe_session.h"
+#include "ttt_solved.h"
+#include "stats.h"
+#include "journal.h"
+
+// 세션 로그 출력 (verbose 세션만 출력)
+#define SESSION_LOG(s, ...)            \
+    do                                 \
+    {                                  \
+        if ((s)->verbose)              \
+        {                              \
+            printf("[세션 %d] ", (s)->id); \
+            printf(__VA_ARGS__);       \
+            fflush(stdout);            \
+        }                              \
+    } while (0)
+
+// 게임 초기화 함수
+int init_game(GameState *game, int rows, int cols, int k)
+{
+    if (mnk_init(&game->board, rows, cols, k) == -1)
+        return -1; // 잘못된 게임판 크기
+    ttt_init(&game->bits);
+    game->classic = (rows == TTT_SIDE && cols == TTT_SIDE && k == TTT_SIDE);
+    game->turn = 0;
+    game->winner = -1;
+    game->last_row = -1;
+    game->last_col = -1;
+    game->win_line = -1;
+    return 0;
+}
+
+// 승리/무승부 판정 함수 (-1: 진행 중, 0 또는 1: 승자, 2: 무승부), 출력 없음
+int check_result(GameState *game)
+{
+    if (game->classic)
+    {
+        // 틱택토: 수마다 갱신한 3진수 인덱스로 미리 계산한 상태 표를 한 번 조회
+        uint8_t state = ttt_state(&game->bits);
+        game->win_line = TTT_STATE_LINE(state);
+        switch (TTT_STATE_RESULT(state))
+        {
+        case TTT_STATE_X_WINS:
+            return 0;
+        case TTT_STATE_O_WINS:
+            return 1;
+        case TTT_STATE_DRAW:
+            return 2;
+        default:
+            return -1;
+        }
+    }
+
+    if (game->last_row == -1)
+        return -1; // 아직 둔 수가 없음
+    // m×n 게임판: 마지막 수를 지나는 네 줄만 확인
+    if (mnk_wins_at(&game->board, game->last_row, game->last_col))
+        return mnk_cell(&game->board, game->last_row, game->last_col);
+    return mnk_is_full(&game->board) ? 2 : -1;
+}
+
+// 판정 결과를 로그용 문장으로 작성 (check_result 이후 호출)
+void describe_result(const GameState *game, char *buf, size_t size)
+{
+    if (game->winner == 2)
+        snprintf(buf, size, "무승부");
+    else if (game->winner == -1)
+        snprintf(buf, size, "중단됨"); // 승부가 나기 전에 끝남 (접속 끊김 등)
+    else if (!game->classic)
+        snprintf(buf, size, "플레이어 %d 승리, (%d, %d)에서 %d목!", game->winner, game->last_row, game->last_col,
+                 game->board.k);
+    else if (game->win_line < 3)
+        snprintf(buf, size, "플레이어 %d 승리, 가로줄 %d!", game->winner, game->win_line);
+    else if (game->win_line < 6)
+        snprintf(buf, size, "플레이어 %d 승리, 세로줄 %d!", game->winner, game->win_line - 3);
+    else
+        snprintf(buf, size, "플레이어 %d 승리, 대각선!", game->winner);
+}
+
+// 수를 두는 함수
+int make_move(GameState *game, int player_id, int row, int col)
+{
+    if (mnk_place(&game->board, player_id, row, col) == -1)
+        return -1; // 잘못된 좌표 또는 이미 수가 존재함
+    if (game->classic)
+        ttt_place(&game->bits, player_id, row * TTT_SIDE + col);
+    game->last_row = row;
+    game->last_col = col;
+    return 0; // 성공
+}
+
+// 세션 상태를 상태 파일에 저장 (game_mutex를 잡은 상태 또는 세션을 혼자 다루는 스레드에서 호출)
+//  mmap 한 파일에 복사만 하므로 시스템 호출 없음
+static void session_commit(GameSession *session)
+{
+    StateFile *state = session->table != NULL ? session->table->state : NULL;
+    if (state == NULL)
+        return;
+    const GameState *game = &session->game;
+    StateSnapshot snapshot;
+    snapshot.turn = game->turn;
+    snapshot.winner = game->winner;
+    snapshot.over = session->game_over_flag;
+    for (int i = 0; i < MAX_CLIENTS; i++)
+        snapshot.connected[i] = i == session->bot_player || session->clients[i].ready;
+    snapshot.last_row = game->last_row;
+    snapshot.last_col = game->last_col;
+    snapshot.moves = session->moves;
+    memcpy(snapshot.cells, game->board.cells, (size_t)(game->board.rows * game->board.cols));
+    state_save(state, session->id, &snapshot);
+}
+
+// 상태 파일에서 불러온 게임 복원: 돌을 다시 놓아 비트보드까지 맞추고, 차례와 결과가 돌과 맞는지 확인
+//  -1: 규칙과 맞지 않음 (새 게임으로 시작)
+static int restore_session(GameSession *session, const StateSnapshot *snapshot)
+{
+    GameState *game = &session->game;
+    int cols = game->board.cols, cells = game->board.rows * cols;
+    int stones[MAX_CLIENTS] = {0, 0};
+    for (int i = 0; i < cells; i++)
+    {
+        int player = snapshot->cells[i];
+        if (player == MNK_EMPTY)
+            continue;
+        make_move(game, player, i / cols, i % cols);
+        stones[player]++;
+    }
+    game->turn = snapshot->turn;
+    game->last_row = snapshot->last_row;
+    game->last_col = snapshot->last_col;
+    int lead = stones[0] - stones[1]; // 선공(0)은 같거나 하나 더 많음, 진행 중이면 차례와 같음
+    int last_ok = snapshot->moves == 0 ? game->last_row == -1
+                                       : game->last_row != -1 &&
+                                             mnk_cell(&game->board, game->last_row, game->last_col) != MNK_EMPTY;
+    int result = last_ok ? check_result(game) : -1;
+    if (!last_ok || stones[0] + stones[1] != snapshot->moves || lead < 0 || lead > 1 ||
+        (!snapshot->over && game->turn != lead) || result != snapshot->winner)
+    {
+        init_game(game, game->board.rows, cols, game->board.k);
+        return -1;
+    }
+    game->winner = result;
+    session->moves = snapshot->moves;
+    if (snapshot->over)
+    {
+        session->restored_over = 1;
+        session->game_over_flag = 1;
+    }
+    return 0;
+}
+
+// 통계를 남기는 게임 잠금: 잠근 시점부터 풀 때까지를 보유 시간으로 기록
+static void session_lock(GameSession *session)
+{
+    pthread_mutex_lock(&session->game_mutex);
+    session->locked_ns = stats_now_ns();
+}
+
+static void session_unlock(GameSession *session)
+{
+    stats_time(STATS_LOCK_HOLD, stats_now_ns() - session->locked_ns);
+    pthread_mutex_unlock(&session->game_mutex);
+}
+
+// 통계를 남기는 FIFO 송수신 (쓰기/읽기 시스템 호출 시간)
+static int session_send(int fd, const WireMessage *msg)
+{
+    uint64_t start = stats_now_ns();
+    int rc = wire_send(fd, msg);
+    stats_time(STATS_WRITE, stats_now_ns() - start);
+    return rc;
+}
+
+static ssize_t session_fill(WireReader *reader, int fd)
+{
+    uint64_t start = stats_now_ns();
+    ssize_t n = wire_reader_fill(reader, fd);
+    stats_time(STATS_READ, stats_now_ns() - start);
+    return n;
+}
+
+// wire_recv 와 같지만 읽기마다 통계를 남김
+static int session_recv(WireReader *reader, int fd, WireMessage *msg)
+{
+    for (;;)
+    {
+        int rc = wire_reader_next(reader, msg);
+        if (rc != 0)
+            return rc;
+        ssize_t n = session_fill(reader, fd);
+        if (n <= 0)
+            return (int)n;
+    }
+}
+
+// 차례 알림 메시지에 현재 게임판을 담아 작성 (game_mutex를 잡은 상태에서 호출)
+static void build_turn_message(WireMessage *msg, const GameSession *session, int player)
+{
+    const GameState *game = &session->game;
+    msg->type = WIRE_YOUR_TURN;
+    msg->session = session->id;
+    msg->player = player;
+    msg->turn = game->turn;
+    msg->row = game->last_row;
+    msg->col = game->last_col;
+    msg->rows = game->board.rows;
+    msg->cols = game->board.cols;
+    memcpy(msg->cells, game->board.cells, (size_t)game->board.rows * game->board.cols);
+    msg->timestamp_ns = wire_now_ns();
+}
+
+// 수 하나의 시간을 서버가 잰 시각으로 나눔 (game_mutex를 잡은 상태에서 호출)
+//  왕복(차례 알림 -> 수 도착)은 서버 시계로 재고, 클라이언트가 보고한 입력 시간은 그 안을 나누는 데만 씀
+static void move_arrived(GameSession *session, ClientInfo *client, const WireMessage *msg, uint64_t arrival_ns)
+{
+    uint64_t think = msg->think_ns;
+    if (client->turn_sent_ns != 0 && arrival_ns > client->turn_sent_ns)
+    {
+        uint64_t round = arrival_ns - client->turn_sent_ns;
+        if (think > round)
+            think = round;
+        hdr_record(&session->timings[SESSION_TIMING_IPC], round - think);
+    }
+    hdr_record(&session->timings[SESSION_TIMING_THINK], think);
+    session->arrival_ns = arrival_ns;
+}
+
+// 차례 알림이나 게임 종료를 작성하는 시점: 직전 수가 도착한 뒤의 서버 처리 시간 기록 (game_mutex를 잡은 상태)
+static void reply_started(GameSession *session, uint64_t now_ns)
+{
+    if (session->arrival_ns == 0)
+        return;
+    hdr_record(&session->timings[SESSION_TIMING_SERVER], now_ns - session->arrival_ns);
+    session->arrival_ns = 0;
+}
+
+static void turn_started(GameSession *session, int player, uint64_t now_ns)
+{
+    reply_started(session, now_ns);
+    ClientInfo *client = &session->clients[player];
+    client->turn_sent_ns = client->ready ? now_ns : 0;
+}
+
+// 잘못된 수 알림 후 같은 플레이어에게 차례를 다시 줌
+static void reject_move(ClientInfo *client)
+{
+    WireMessage msg = {.type = WIRE_INVALID_MOVE, .session = client->session->id, .player = client->id};
+    msg.timestamp_ns = wire_now_ns();
+    stats_count(STATS_INVALID_MOVES, 1);
+    if (session_send(client->pipe_fd[PIPE_WRITE], &msg) == -1)
+    {
+        perror("write Invalid Move to client failed");
+    }
+    // 현재 클라이언트의 세마포어 다시 해제
+    if (sem_post(&client->turn_sem) == -1)
+    {
+        perror("sem_post failed");
+    }
+}
+
+// 세션 스택 크기를 적용하여 스레드 생성
+static int session_spawn(GameSession *session, pthread_t *thread, void *(*fn)(void *), void *arg)
+{
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    if (session->stack_size > 0)
+        pthread_attr_setstacksize(&attr, session->stack_size);
+    int rc = pthread_create(thread, &attr, fn, arg);
+    pthread_attr_destroy(&attr);
+    return rc;
+}
+
+// 게임 종료 처리: 두 플레이어에게 즉시 결과를 전송하고 대기 중인 핸들러를 깨움
+//  game_mutex를 잡은 상태에서 호출하며, 세션당 한 번만 실행됨
+static void finish_game(GameSession *session)
+{
+    if (session->game_over_flag)
+        return;
+    session->game_over_flag = 1;
+    stats_count(STATS_GAMES_FINISHED, 1);
+    journal_end(session->id, session->game.winner);
+    session_commit(session);
+    SESSION_LOG(session, "**게임 종료 감지**\n");
+    if (session->game.winner != -1)
+    {
+        char result[64];
+        describe_result(&session->game, result, sizeof(result));
+        SESSION_LOG(session, "%s\n", result);
+    }
+
+    // 게임 종료 메시지 전송 및 세마포어 해제
+    WireMessage msg = {.type = WIRE_GAME_OVER, .session = session->id, .winner = session->game.winner};
+    msg.timestamp_ns = wire_now_ns();
+    reply_started(session, msg.timestamp_ns);
+
+    // 세션의 시간 분포를 전체 분포에 합침 (게임당 한 번)
+    SessionTable *table = session->table;
+    if (table != NULL)
+    {
+        pthread_mutex_lock(&table->timings_lock);
+        for (int k = 0; k < SESSION_TIMINGS; k++)
+            hdr_merge(&table->timings[k], &session->timings[k]);
+        table->timed_games++;
+        pthread_mutex_unlock(&table->timings_lock);
+    }
+
+    for (int i = 0; i < MAX_CLIENTS; i++)
+    {
+        ClientInfo *client = &session->clients[i];
+        if (i == session->bot_player)
+            continue; // 서버 봇은 FIFO 도 핸들러도 없음
+        msg.player = i;
+        if (session_send(client->pipe_fd[PIPE_WRITE], &msg) == -1)
+        {
+            perror("write to client failed");
+        }
+
+        // 세마포어 해제
+        if (sem_post(&client->turn_sem) == -1)
+        {
+            perror("sem_post failed");
+        }
+    }
+}
+
+#define BOT_QUEUED 2 // bot_play: 봇 스레드의 대기열에 넣음 (봇 스레드가 수를 두고 다음 차례를 알림)
+
+// 서버 봇의 수를 게임에 반영 (game_mutex를 잡은 상태에서 호출)
+//  봇의 수로 게임이 끝나면 1 반환 (아니면 차례를 넘김)
+//  둘 칸이 없거나(-1) 둘 수 없는 칸이면 게임 상태는 그대로 두고 1 반환 (승자 없이 중단, 봇 차례에서 멈추지 않음)
+static int bot_apply(GameSession *session, int cell)
+{
+    GameState *game = &session->game;
+    int row = cell / game->board.cols, col = cell % game->board.cols;
+    if (cell == -1 || make_move(game, session->bot_player, row, col) == -1)
+    {
+        fprintf(stderr, "[세션 %d] 서버 봇(플레이어 %d)이 칸 %d에 둘 수 없어 게임 중단\n", session->id,
+                session->bot_player, cell);
+        fflush(stderr);
+        return 1;
+    }
+    journal_move(session->id, session->bot_player, cell);
+    session->moves++;
+    stats_count(STATS_MOVES, 1);
+    SESSION_LOG(session, "서버 봇(플레이어 %d)의 수: (%d, %d)\n", session->bot_player, row, col);
+
+    game->winner = check_result(game);
+    if (game->winner != -1)
+        return 1;
+    game->turn = 1 - game->turn;
+    return 0;
+}
+
+// 봇 차례가 된 세션을 봇 스레드의 대기열에 넣음 (game_mutex를 잡은 상태에서 호출)
+static void bot_enqueue(GameSession *session)
+{
+    SessionTable *table = session->table;
+    pthread_mutex_lock(&table->bot_lock);
+    session->bot_next = NULL;
+    if (table->bot_tail != NULL)
+        table->bot_tail->bot_next = session;
+    else
+        table->bot_head = session;
+    table->bot_tail = session;
+    pthread_cond_signal(&table->bot_wake);
+    pthread_mutex_unlock(&table->bot_lock);
+}
+
+// 서버 봇의 차례면 둠 (game_mutex를 잡은 상태에서 호출)
+//  3x3 은 미리 푼 표 조회 한 번이므로 바로 두고, 더 큰 게임판은 탐색이 길어서 봇 스레드에 넘기고 BOT_QUEUED 반환
+//  봇의 수로 게임이 끝나면 1, 아니면 0 (차례를 넘김)
+static int bot_play(GameSession *session)
+{
+    GameState *game = &session->game;
+    if (session->bot_player == -1 || game->turn != session->bot_player || game->winner != -1)
+        return 0;
+    if (!game->classic)
+    {
+        bot_enqueue(session);
+        return BOT_QUEUED;
+    }
+    int cell = ttt_solved_move(&game->bits);
+    return bot_apply(session, (cell / TTT_SIDE) * game->board.cols + cell % TTT_SIDE);
+}
+
+// 클라이언트 핸들러 함수
+static void *client_handler(void *arg)
+{
+    ClientInfo *client = (ClientInfo *)arg;
+    GameSession *session = client->session;
+    GameState *game = &session->game;
+    SESSION_LOG(session, "**클라이언트 %d의 스레드 연결 확인**\n", client->id);
+    WireMessage msg;
+
+    while (!session->game_over_flag)
+    {
+        // 차례 대기
+        uint64_t wait_start = stats_now_ns();
+        if (sem_wait(&client->turn_sem) == -1)
+        {
+            perror("sem_wait failed");
+            break;
+        }
+        stats_time(STATS_WAIT, stats_now_ns() - wait_start);
+
+        if (session->game_over_flag)
+        {
+            break;
+        }
+
+        // 차례 시작 알림 (현재 게임판을 메시지에 담아 전송, 파일을 거치지 않음)
+        session_lock(session);
+        build_turn_message(&msg, session, client->id);
+        turn_started(session, client->id, msg.timestamp_ns);
+        session_unlock(session);
+        if (session_send(client->pipe_fd[PIPE_WRITE], &msg) == -1)
+        {
+            perror("write Your Turn to client failed");
+            continue;
+        }
+
+        // 현재 플레이어의 턴임을 서버 콘솔에 출력
+        SESSION_LOG(session, "플레이어 %d의 턴.\n", client->id);
+
+        // 클라이언트의 수 입력 대기 (프레임 단위로 재조립)
+        int n = session_recv(&client->reader, client->pipe_fd[PIPE_READ], &msg);
+        uint64_t arrival = wire_now_ns(); // 서버 시계로 잰 수 도착 시각
+        if (n == -1)
+        {
+            perror("read failed");
+        }
+        if (n > 0 || n == WIRE_CORRUPT)
+        {
+            if (n == WIRE_CORRUPT || msg.type != WIRE_MOVE || msg.session != session->id)
+            {
+                // 손상된 프레임 또는 다른 종류의 메시지: 버퍼를 비우고 다시 입력 요청
+                fprintf(stderr, "[세션 %d] Invalid input format from client %d.\n", session->id, client->id);
+                fflush(stderr);
+                wire_reader_init(&client->reader);
+                reject_move(client);
+                continue;
+            }
+            int row = msg.row, col = msg.col;
+
+            session_lock(session);
+            if (make_move(game, client->id, row, col) == 0)
+            {
+                move_arrived(session, client, &msg, arrival);
+                journal_move(session->id, client->id, row * game->board.cols + col);
+                session->moves++;
+                stats_count(STATS_MOVES, 1);
+
+                // 수를 둔 직후 승리/무승부 확인
+                game->winner = check_result(game);
+                if (game->winner != -1)
+                {
+                    finish_game(session);
+                    session_unlock(session);
+                    break;
+                }
+
+                // 다음 차례로 전환 (상대가 서버 봇이면 바로 두고 다시 이 플레이어 차례)
+                game->turn = 1 - game->turn;
+                int bot = bot_play(session);
+                if (bot == 1)
+                {
+                    finish_game(session);
+                    session_unlock(session);
+                    break;
+                }
+                session_commit(session);
+                int next = game->turn;
+                session_unlock(session);
+
+                // 다음 플레이어의 세마포어 해제 (봇 스레드에 넘겼으면 봇이 둔 뒤 봇 스레드가 해제)
+                if (bot != BOT_QUEUED && sem_post(&session->clients[next].turn_sem) == -1)
+                {
+                    perror("sem_post failed");
+                }
+            }
+            else
+            {
+                // 잘못된 수, 다시 시도 요청
+                session_unlock(session);
+                reject_move(client);
+            }
+        }
+        else
+        {
+            // 파이프가 닫혔거나 읽기 오류
+            SESSION_LOG(session, "**클라이언트 %d의 파이프 연결 종료\n", client->id);
+            // 상대 플레이어도 대기에서 풀려나도록 게임 종료 처리
+            session_lock(session);
+            finish_game(session);
+            session_unlock(session);
+            break; // 스레드 종료
+        }
+    }
+    SESSION_LOG(session, "**클라이언트 %d과 스레드 연결 종료**\n", client->id);
+    return NULL;
+}
+
+// 세션 스레드: 두 클라이언트의 접속을 받고 한 판의 게임을 진행
+static void *session_thread(void *arg)
+{
+    GameSession *session = (GameSession *)arg;
+    int connected = 0;
+
+    // 클라이언트 접속 대기 (플레이어 0, 1 순서, 서버 봇이 두는 쪽은 건너뜀)
+    while (connected < MAX_CLIENTS)
+    {
+        if (connected == session->bot_player)
+        {
+            connected++;
+            continue;
+        }
+        ClientInfo *client = &session->clients[connected];
+        int fd_read = open(client->fifo_name, O_RDONLY);
+        if (fd_read == -1)
+        {
+            if (errno == EINTR)
+                continue;
+            perror("Failed to open client FIFO for reading");
+            break;
+        }
+        int fd_write = open(client->server_fifo, O_WRONLY);
+        if (fd_write == -1)
+        {
+            perror("Failed to open server FIFO for writing");
+            close(fd_read);
+            break;
+        }
+        client->pipe_fd[PIPE_READ] = fd_read;
+        client->pipe_fd[PIPE_WRITE] = fd_write;
+        client->ready = 1;
+        session_commit(session); // 게임 시작 전에는 이 스레드만 세션을 다룸
+        connected++;
+        SESSION_LOG(session, "**클라이언트 %d 접속**\n", client->id);
+    }
+
+    if (connected < MAX_CLIENTS)
+    {
+        for (int i = 0; i < connected; i++)
+        {
+            if (i == session->bot_player)
+                continue;
+            close(session->clients[i].pipe_fd[PIPE_READ]);
+            close(session->clients[i].pipe_fd[PIPE_WRITE]);
+        }
+        return NULL;
+    }
+
+    // 게임 시작 시간 기록 (두 클라이언트가 연결된 시점)
+    clock_gettime(CLOCK_MONOTONIC, &session->game_start_time);
+    stats_count(STATS_GAMES_STARTED, 1);
+    SESSION_LOG(session, "**게임 시작 알림**\n");
+
+    // 선공의 세마포어 해제 (서버 봇이 선공이면 첫 수를 두고 상대 차례로)
+    session_lock(session);
+    int bot = bot_play(session);
+    if (bot == 1)
+        finish_game(session); // 봇이 첫 수를 둘 수 없음 (핸들러는 시작하자마자 끝남)
+    session_commit(session);
+    int first = session->game.turn;
+    session_unlock(session);
+    if (bot == 0 && sem_post(&session->clients[first].turn_sem) == -1)
+    {
+        perror("sem_post failed");
+    }
+
+    // 클라이언트별로 스레드 생성 (클라이언트 핸들러 스레드)
+    pthread_t client_threads[MAX_CLIENTS];
+    for (int i = 0; i < MAX_CLIENTS; i++)
+    {
+        if (i == session->bot_player)
+            continue;
+        if (session_spawn(session, &client_threads[i], client_handler, &session->clients[i]) != 0)
+        {
+            perror("Failed to create client handler thread");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    // 모든 클라이언트 핸들러 스레드가 종료될 때까지 대기 (종료는 수를 둔 핸들러가 감지)
+    for (int i = 0; i < MAX_CLIENTS; i++)
+    {
+        if (i != session->bot_player)
+            pthread_join(client_threads[i], NULL);
+    }
+
+    // 게임 종료 시간 기록
+    clock_gettime(CLOCK_MONOTONIC, &session->game_end_time);
+
+    // 파이프 닫기
+    for (int i = 0; i < MAX_CLIENTS; i++)
+    {
+        if (i == session->bot_player)
+            continue;
+        close(session->clients[i].pipe_fd[PIPE_READ]);
+        close(session->clients[i].pipe_fd[PIPE_WRITE]);
+    }
+    return NULL;
+}
+
+// 풀 모드: 차례 알림 전송 (game_mutex를 잡은 상태에서 호출)
+static void pool_send_turn(GameSession *session, int player)
+{
+    WireMessage msg;
+    build_turn_message(&msg, session, player);
+    turn_started(session, player, msg.timestamp_ns);
+    if (session_send(session->clients[player].pipe_fd[PIPE_WRITE], &msg) == -1)
+    {
+        perror("write Your Turn to client failed");
+        return;
+    }
+    SESSION_LOG(session, "플레이어 %d의 턴.\n", player);
+}
+
+// 풀 모드: 잘못된 수 알림 후 차례인 플레이어면 차례를 다시 줌
+static void pool_reject_move(GameSession *session, ClientInfo *client)
+{
+    WireMessage msg = {.type = WIRE_INVALID_MOVE, .session = session->id, .player = client->id};
+    msg.timestamp_ns = wire_now_ns();
+    stats_count(STATS_INVALID_MOVES, 1);
+    if (session_send(client->pipe_fd[PIPE_WRITE], &msg) == -1)
+    {
+        perror("write Invalid Move to client failed");
+    }
+    if (session->game.turn == client->id)
+        pool_send_turn(session, client->id);
+}
+
+// 풀 모드: 끝난 세션의 FIFO 를 닫고, 마지막 세션이면 이벤트 대기 스레드를 깨움
+//  game_mutex를 잡은 상태에서 게임을 끝낸 작업자만 호출 (상대 클라이언트의 이벤트는 game_over_flag 를 보고 무시됨)
+static void pool_close_session(GameSession *session)
+{
+    SessionTable *table = session->table;
+    clock_gettime(CLOCK_MONOTONIC, &session->game_end_time);
+    for (int i = 0; i < MAX_CLIENTS; i++)
+    {
+        ClientInfo *client = &session->clients[i];
+        if (i == session->bot_player)
+            continue;
+        epoll_ctl(table->epoll_fd, EPOLL_CTL_DEL, client->pipe_fd[PIPE_READ], NULL);
+        close(client->pipe_fd[PIPE_READ]);
+        close(client->pipe_fd[PIPE_WRITE]);
+        client->pipe_fd[PIPE_READ] = -1;
+        client->pipe_fd[PIPE_WRITE] = -1;
+    }
+    if (atomic_fetch_add(&table->finished, 1) + 1 == table->count)
+    {
+        uint64_t one = 1;
+        if (write(table->wake_fd, &one, sizeof(one)) != sizeof(one))
+            perror("write wake eventfd failed");
+    }
+}
+
+// 대기열에서 꺼낸 세션의 봇 차례: 게임판을 복사해 game_mutex 밖에서 탐색하고, 다시 잠가 수를 둠
+//  탐색하는 동안 상대는 차례가 아니므로 수를 둘 수 없고, 바뀔 수 있는 것은 접속 끊김에 의한 게임 종료뿐
+static void bot_turn(GameSession *session)
+{
+    SessionTable *table = session->table;
+    GameState *game = &session->game;
+    session_lock(session);
+    MnkBoard board = game->board;
+    int moves = session->moves, over = session->game_over_flag;
+    session_unlock(session);
+    if (over)
+        return;
+
+    int cell = -1;
+    MnkSearchResult result;
+    if (mnk_search_best(&table->search, &board, session->bot_player, table->bot_think_ms, &result) == 0)
+    {
+        cell = result.move;
+        SESSION_LOG(session, "서버 봇 탐색: 깊이 %d, 평가 %d, %lu노드, %.0f nodes/sec\n", result.depth, result.score,
+                    (unsigned long)result.nodes, result.nodes / (result.elapsed_ns / 1e9));
+    }
+
+    session_lock(session);
+    if (session->game_over_flag || session->moves != moves)
+    {
+        session_unlock(session);
+        return; // 탐색하는 동안 게임이 끝남
+    }
+    if (bot_apply(session, cell))
+    {
+        finish_game(session);
+        if (table->workers > 0)
+            pool_close_session(session);
+    }
+    else
+    {
+        session_commit(session);
+        if (table->workers > 0)
+            pool_send_turn(session, game->turn);
+        else if (sem_post(&session->clients[game->turn].turn_sem) == -1)
+            perror("sem_post failed");
+    }
+    session_unlock(session);
+}
+
+// 서버 봇 스레드: 대기열의 세션을 하나씩 꺼내 봇 차례를 진행
+//  탐색 엔진이 하나이므로 여러 세션의 탐색은 차례로 (탐색마다 스레드 묶음이 모든 CPU 를 씀)
+//  작업자 풀이나 클라이언트 핸들러는 탐색을 기다리지 않고 바로 다른 이벤트를 처리함
+static void *bot_thread(void *arg)
+{
+    SessionTable *table = (SessionTable *)arg;
+    pthread_mutex_lock(&table->bot_lock);
+    for (;;)
+    {
+        while (table->bot_head == NULL && !table->bot_quit)
+            pthread_cond_wait(&table->bot_wake, &table->bot_lock);
+        if (table->bot_quit)
+            break; // 모든 게임이 끝난 뒤이므로 남은 세션도 끝난 게임
+        GameSession *session = table->bot_head;
+        table->bot_head = session->bot_next;
+        if (table->bot_head == NULL)
+            table->bot_tail = NULL;
+        pthread_mutex_unlock(&table->bot_lock);
+        bot_turn(session);
+        pthread_mutex_lock(&table->bot_lock);
+    }
+    pthread_mutex_unlock(&table->bot_lock);
+    return NULL;
+}
+
+// 풀 모드: 수 하나 처리 (game_mutex를 잡은 상태에서 호출)
+static void pool_handle_move(GameSession *session, ClientInfo *client, int rc, const WireMessage *msg,
+                             uint64_t arrival_ns)
+{
+    GameState *game = &session->game;
+    if (rc == WIRE_CORRUPT || msg->type != WIRE_MOVE || msg->session != session->id)
+    {
+        // 손상된 프레임 또는 다른 종류의 메시지: 버퍼를 비우고 다시 입력 요청
+        fprintf(stderr, "[세션 %d] Invalid input format from client %d.\n", session->id, client->id);
+        fflush(stderr);
+        wire_reader_init(&client->reader);
+        pool_reject_move(session, client);
+        return;
+    }
+    // 세마포어가 차례를 보장하던 스레드 모드와 달리 차례가 아닌 수도 여기서 거름
+    if (game->turn != client->id || make_move(game, client->id, msg->row, msg->col) == -1)
+    {
+        pool_reject_move(session, client);
+        return;
+    }
+    move_arrived(session, client, msg, arrival_ns);
+    journal_move(session->id, client->id, msg->row * game->board.cols + msg->col);
+    stats_count(STATS_MOVES, 1);
+    if (session->moves++ == (session->bot_player == 0)) // 서버 봇의 첫 수는 빼고 사람의 첫 수
+    {
+        // 접속 시점을 알 수 없으므로 첫 수의 입력 시간을 빼서 첫 차례 알림 시점을 게임 시작으로 봄
+        uint64_t start = wire_now_ns() - msg->think_ns;
+        session->game_start_time.tv_sec = start / 1000000000ull;
+        session->game_start_time.tv_nsec = start % 1000000000ull;
+    }
+
+    // 수를 둔 직후 승리/무승부 확인
+    game->winner = check_result(game);
+    if (game->winner != -1)
+    {
+        finish_game(session);
+        return;
+    }
+    game->turn = 1 - game->turn;
+    int bot = bot_play(session);
+    if (bot == 1)
+    {
+        finish_game(session);
+        return;
+    }
+    session_commit(session);
+    if (bot != BOT_QUEUED)
+        pool_send_turn(session, game->turn);
+}
+
+// 풀 모드 작업: 클라이언트 FIFO 를 한 번 읽고 완성된 프레임을 모두 처리
+//  EPOLLONESHOT 이므로 같은 클라이언트의 작업은 동시에 하나만 실행됨 (두 클라이언트는 game_mutex 로 직렬화)
+static void client_event(WorkTask *task)
+{
+    ClientInfo *client = (ClientInfo *)((char *)task - offsetof(ClientInfo, task));
+    GameSession *session = client->session;
+    session_lock(session);
+    if (session->game_over_flag)
+    {
+        session_unlock(session);
+        return; // 상대 쪽에서 이미 끝내고 FIFO 를 닫음
+    }
+    if (!client->ready)
+    {
+        client->ready = 1; // 첫 차례 알림은 접속 전에 보냈을 수 있으므로 첫 이벤트부터 왕복 시간을 잼
+        session_commit(session);
+    }
+
+    ssize_t n = session_fill(&client->reader, client->pipe_fd[PIPE_READ]);
+    uint64_t arrival = wire_now_ns(); // 서버 시계로 잰 수 도착 시각
+    if (n == 0 || (n == -1 && errno != EAGAIN && errno != EWOULDBLOCK))
+    {
+        // 파이프가 닫혔거나 읽기 오류: 상대 플레이어에게도 결과를 보내고 게임 종료
+        if (n == -1)
+            perror("read failed");
+        SESSION_LOG(session, "**클라이언트 %d의 파이프 연결 종료\n", client->id);
+        finish_game(session);
+    }
+    WireMessage msg;
+    int rc;
+    while (!session->game_over_flag && (rc = wire_reader_next(&client->reader, &msg)) != 0)
+    {
+        pool_handle_move(session, client, rc, &msg, arrival);
+    }
+
+    if (session->game_over_flag)
+    {
+        pool_close_session(session);
+    }
+    else
+    {
+        struct epoll_event ev = {.events = EPOLLIN | EPOLLONESHOT, .data.ptr = client};
+        if (epoll_ctl(session->table->epoll_fd, EPOLL_CTL_MOD, client->pipe_fd[PIPE_READ], &ev) == -1)
+            perror("epoll_ctl rearm failed");
+    }
+    session_unlock(session);
+}
+
+// 풀 모드 이벤트 대기 스레드: 읽을 수 있는 클라이언트를 작업자 풀에 넣음
+static void *session_poller(void *arg)
+{
+    SessionTable *table = (SessionTable *)arg;
+    struct epoll_event events[SESSION_EVENT_BATCH];
+    while (atomic_load(&table->finished) < table->count)
+    {
+        int n = epoll_wait(table->epoll_fd, events, SESSION_EVENT_BATCH, -1);
+        if (n == -1)
+        {
+            if (errno == EINTR)
+                continue;
+            perror("epoll_wait failed");
+            break;
+        }
+        for (int i = 0; i < n; i++)
+        {
+            ClientInfo *client = (ClientInfo *)events[i].data.ptr;
+            if (client != NULL) // NULL: wake_fd
+                work_pool_submit(&table->pool, &client->task);
+        }
+    }
+    return NULL;
+}
+
+// 풀 모드 시작: 모든 FIFO 를 블로킹 없이 열어 epoll 에 등록하고 선공에게 첫 차례 알림
+//  클라이언트 FIFO 는 O_NONBLOCK 읽기, 서버 FIFO 는 O_RDWR 로 열어 클라이언트가 아직 없어도 open 이 막히지 않음
+//  (클라이언트가 열기 전에 보낸 차례 알림은 FIFO 에 남아 있다가 클라이언트가 읽음)
+static int pool_start(SessionTable *table)
+{
+    for (int s = 0; s < table->count; s++)
+    {
+        GameSession *session = &table->sessions[s];
+        if (session->restored_over)
+        {
+            atomic_fetch_add(&table->finished, 1); // 이전 실행에서 끝난 게임
+            continue;
+        }
+        for (int i = 0; i < MAX_CLIENTS; i++)
+        {
+            ClientInfo *client = &session->clients[i];
+            if (i == session->bot_player)
+                continue;
+            client->pipe_fd[PIPE_READ] = open(client->fifo_name, O_RDONLY | O_NONBLOCK);
+            if (client->pipe_fd[PIPE_READ] == -1)
+            {
+                perror("Failed to open client FIFO for reading");
+                return -1;
+            }
+            client->pipe_fd[PIPE_WRITE] = open(client->server_fifo, O_RDWR);
+            if (client->pipe_fd[PIPE_WRITE] == -1)
+            {
+                perror("Failed to open server FIFO for writing");
+                return -1;
+            }
+            client->task.run = client_event;
+            struct epoll_event ev = {.events = EPOLLIN | EPOLLONESHOT, .data.ptr = client};
+            if (epoll_ctl(table->epoll_fd, EPOLL_CTL_ADD, client->pipe_fd[PIPE_READ], &ev) == -1)
+            {
+                perror("epoll_ctl add failed");
+                return -1;
+            }
+        }
+        clock_gettime(CLOCK_MONOTONIC, &session->game_start_time);
+        stats_count(STATS_GAMES_STARTED, 1);
+        session_lock(session); // 봇 스레드가 이미 돌고 있음
+        int bot = bot_play(session); // 서버 봇이 선공이면 첫 수를 두고 상대에게 차례 알림
+        if (bot == 1)
+        {
+            finish_game(session); // 봇이 첫 수를 둘 수 없음
+            pool_close_session(session);
+        }
+        else if (bot == 0)
+        {
+            session_commit(session);
+            pool_send_turn(session, session->game.turn);
+        }
+        session_unlock(session);
+    }
+
+    if (work_pool_start(&table->pool) == -1)
+        return -1;
+    if (pthread_create(&table->poller, NULL, session_poller, table) != 0)
+    {
+        perror("Failed to create poller thread");
+        work_pool_stop(&table->pool);
+        return -1;
+    }
+    return 0;
+}
+
+// 기본 설정: 세션 1개, 현재 디렉터리, 3x3 3목
+void session_config_default(SessionConfig *config)
+{
+    memset(config, 0, sizeof(*config));
+    config->count = 1;
+    config->dir = ".";
+    config->verbose = 1;
+    config->rows = TTT_SIDE;
+    config->cols = TTT_SIDE;
+    config->k = TTT_SIDE;
+    config->bot_player = -1;
+    config->bot_think_ms = SESSION_BOT_THINK_MS;
+    config->bot_threads = work_pool_cpus();
+}
+
+// 세션 테이블 초기화: 세션별 상태, 세마포어, FIFO 생성
+int session_table_init(SessionTable *table, const SessionConfig *config)
+{
+    int count = config->count;
+    const char *dir = config->dir;
+    memset(table, 0, sizeof(*table));
+    snprintf(table->dir, sizeof(table->dir), "%s", dir);
+    table->workers = config->workers;
+    table->state = config->state;
+    table->epoll_fd = -1;
+    table->wake_fd = -1;
+    table->sessions = calloc(count, sizeof(GameSession));
+    table->threads = calloc(count, sizeof(pthread_t));
+    if (table->sessions == NULL || table->threads == NULL)
+    {
+        perror("Failed to allocate session table");
+        free(table->sessions);
+        free(table->threads);
+        return -1;
+    }
+    for (int k = 0; k < SESSION_TIMINGS; k++)
+        hdr_init(&table->timings[k]);
+    pthread_mutex_init(&table->timings_lock, NULL);
+    pthread_mutex_init(&table->bot_lock, NULL);
+    pthread_cond_init(&table->bot_wake, NULL);
+    table->bot_think_ms = config->bot_think_ms;
+
+    for (int s = 0; s < count; s++)
+    {
+        GameSession *session = &table->sessions[s];
+        session->id = s;
+        session->verbose = config->verbose;
+        session->stack_size = config->stack_size;
+        session->table = table;
+        session->bot_player = config->bot_player;
+        if (init_game(&session->game, config->rows, config->cols, config->k) == -1)
+        {
+            fprintf(stderr, "Invalid board %dx%d, k=%d\n", config->rows, config->cols, config->k);
+            return -1;
+        }
+        pthread_mutex_init(&session->game_mutex, NULL);
+        for (int k = 0; k < SESSION_TIMINGS; k++)
+            hdr_init(&session->timings[k]);
+
+        // 상태 파일에 저장된 게임이 있으면 그 자리에서 이어 둠 (클라이언트는 같은 세션 FIFO 로 다시 접속)
+        StateSnapshot snapshot;
+        if (config->state != NULL && state_load(config->state, s, &snapshot) == 0)
+        {
+            if (restore_session(session, &snapshot) == -1)
+                fprintf(stderr, "[세션 %d] 상태 파일의 게임이 규칙과 맞지 않아 새 게임으로 시작\n", s);
+            else if (!snapshot.over && snapshot.moves + snapshot.connected[0] + snapshot.connected[1] > 0)
+            {
+                table->resumed++;
+                SESSION_LOG(session, "**상태 파일에서 이어 둠: %d수, 플레이어 %d의 차례 (접속했던 플레이어: %s%s)**\n",
+                            snapshot.moves, snapshot.turn, snapshot.connected[0] ? "0 " : "",
+                            snapshot.connected[1] ? "1" : "");
+            }
+        }
+
+        for (int i = 0; i < MAX_CLIENTS; i++)
+        {
+            ClientInfo *client = &session->clients[i];
+            client->id = i;
+            client->session = session;
+            client->pipe_fd[PIPE_READ] = -1;
+            client->pipe_fd[PIPE_WRITE] = -1;
+            sem_init(&client->turn_sem, 0, 0);
+            wire_reader_init(&client->reader);
+            snprintf(client->fifo_name, sizeof(client->fifo_name), CLIENT_FIFO_FORMAT, dir, s, i);
+            snprintf(client->server_fifo, sizeof(client->server_fifo), SERVER_FIFO_FORMAT, dir, s, i);
+
+            // 기존 FIFO 파일 제거 후 생성
+            unlink(client->fifo_name);
+            unlink(client->server_fifo);
+            if (mkfifo(client->fifo_name, 0666) == -1)
+            {
+                perror("Failed to create client FIFO");
+                table->count = s + 1;
+                return -1;
+            }
+            if (mkfifo(client->server_fifo, 0666) == -1)
+            {
+                perror("Failed to create server FIFO");
+                table->count = s + 1;
+                return -1;
+            }
+        }
+        table->count = s + 1;
+    }
+
+    // 3x3 보다 큰 게임판의 서버 봇: 탐색 엔진과 스레드 묶음은 세션 수와 관계없이 하나
+    int classic = config->rows == TTT_SIDE && config->cols == TTT_SIDE && config->k == TTT_SIDE;
+    if (config->bot_player != -1 && !classic)
+    {
+        if (mnk_search_init(&table->search, config->bot_threads, MNK_SEARCH_TT_BITS) == -1)
+        {
+            fprintf(stderr, "Failed to prepare bot search\n");
+            return -1;
+        }
+        table->bot_search = 1;
+    }
+
+    if (table->workers > 0)
+    {
+        // 풀 모드: 작업자 풀과 이벤트 대기용 epoll, eventfd 준비 (스레드는 start 에서 생성)
+        table->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+        table->wake_fd = eventfd(0, EFD_CLOEXEC);
+        if (table->epoll_fd == -1 || table->wake_fd == -1)
+        {
+            perror("Failed to create epoll/eventfd");
+            return -1;
+        }
+        struct epoll_event ev = {.events = EPOLLIN, .data.ptr = NULL};
+        if (epoll_ctl(table->epoll_fd, EPOLL_CTL_ADD, table->wake_fd, &ev) == -1 ||
+            work_pool_init(&table->pool, table->workers, config->stack_size) == -1)
+        {
+            perror("Failed to prepare worker pool");
+            return -1;
+        }
+    }
+    return 0;
+}
+
+// 세션마다 스레드를 생성하여 접속 대기 시작 (풀 모드: 작업자 풀과 이벤트 대기 스레드 시작)
+//  봇 탐색이 필요하면 봇 스레드를 먼저 시작 (세션이 시작하자마자 봇 차례일 수 있음)
+int session_table_start(SessionTable *table)
+{
+    if (table->bot_search)
+    {
+        if (pthread_create(&table->bot_thread, NULL, bot_thread, table) != 0)
+        {
+            perror("Failed to create bot thread");
+            return -1;
+        }
+        table->bot_started = 1;
+    }
+    if (table->workers > 0)
+        return pool_start(table);
+    for (int s = 0; s < table->count; s++)
+    {
+        if (table->sessions[s].restored_over)
+            continue;
+        if (session_spawn(&table->sessions[s], &table->threads[s], session_thread, &table->sessions[s]) != 0)
+        {
+            perror("Failed to create session thread");
+            return -1;
+        }
+    }
+    return 0;
+}
+
+// 봇 스레드 종료 (모든 게임이 끝난 뒤)
+static void bot_stop(SessionTable *table)
+{
+    if (!table->bot_started)
+        return;
+    pthread_mutex_lock(&table->bot_lock);
+    table->bot_quit = 1;
+    pthread_cond_signal(&table->bot_wake);
+    pthread_mutex_unlock(&table->bot_lock);
+    pthread_join(table->bot_thread, NULL);
+    table->bot_started = 0;
+}
+
+// 모든 세션의 게임이 끝날 때까지 대기
+void session_table_join(SessionTable *table)
+{
+    if (table->workers > 0)
+    {
+        pthread_join(table->poller, NULL);
+        work_pool_stop(&table->pool);
+    }
+    else
+    {
+        for (int s = 0; s < table->count; s++)
+        {
+            if (!table->sessions[s].restored_over)
+                pthread_join(table->threads[s], NULL);
+        }
+    }
+    bot_stop(table);
+}
+
+// 리소스 정리
+void session_table_destroy(SessionTable *table)
+{
+    for (int s = 0; s < table->count; s++)
+    {
+        GameSession *session = &table->sessions[s];
+        pthread_mutex_destroy(&session->game_mutex);
+        for (int i = 0; i < MAX_CLIENTS; i++)
+        {
+            // 풀 모드에서 끝나지 않은 세션의 FIFO (스레드 모드는 세션 스레드가 닫음)
+            if (table->workers > 0 && session->clients[i].pipe_fd[PIPE_READ] != -1)
+            {
+                close(session->clients[i].pipe_fd[PIPE_READ]);
+                close(session->clients[i].pipe_fd[PIPE_WRITE]);
+            }
+            sem_destroy(&session->clients[i].turn_sem);
+            unlink(session->clients[i].fifo_name);
+            unlink(session->clients[i].server_fifo);
+        }
+    }
+    if (table->pool.workers != NULL)
+        work_pool_destroy(&table->pool);
+    if (table->epoll_fd != -1)
+        close(table->epoll_fd);
+    if (table->wake_fd != -1)
+        close(table->wake_fd);
+    table->epoll_fd = -1;
+    table->wake_fd = -1;
+    bot_stop(table); // 시작 뒤 join 없이 정리하는 경우
+    if (table->bot_search)
+        mnk_search_destroy(&table->search);
+    table->bot_search = 0;
+    pthread_cond_destroy(&table->bot_wake);
+    pthread_mutex_destroy(&table->bot_lock);
+    pthread_mutex_destroy(&table->timings_lock);
+    free(table->sessions);
+    free(table->threads);
+    table->sessions = NULL;
+    table->threads = NULL;
+    table->count = 0;
+}
+
+static const char *const timing_names[SESSION_TIMINGS] = {"think", "ipc", "server"};
+
+// 시간 분포 표 (us)
+static void print_timings(const HdrHist timings[SESSION_TIMINGS])
+{
+    printf("   %-8s %8s %10s %10s %10s %10s %10s\n", "timing", "samples", "avg us", "p50 us", "p90 us", "p99 us",
+           "max us");
+    for (int k = 0; k < SESSION_TIMINGS; k++)
+    {
+        const HdrHist *hist = &timings[k];
+        printf("   %-8s %8lu %10.1f %10.1f %10.1f %10.1f %10.1f\n", timing_names[k], (unsigned long)hist->count,
+               hdr_mean(hist) / 1e3, hdr_percentile(hist, 0.5) / 1e3, hdr_percentile(hist, 0.9) / 1e3,
+               hdr_percentile(hist, 0.99) / 1e3, hist->max / 1e3);
+    }
+}
+
+// 세션 결과 출력
+void session_print_result(const GameSession *session)
+{
+    // 전체 실행 시간 계산
+    double total_runtime = (session->game_end_time.tv_sec - session->game_start_time.tv_sec) +
+                           (session->game_end_time.tv_nsec - session->game_start_time.tv_nsec) / 1e9;
+
+    // 결과 출력
+    printf("**세션 %d 게임 종료**\n", session->id);
+    if (session->restored_over)
+    {
+        char result[64];
+        describe_result(&session->game, result, sizeof(result));
+        printf("**결과: %s (이전 실행에서 끝난 게임)**\n", result);
+        fflush(stdout);
+        return;
+    }
+    if (session->game.winner == 2 || session->game.winner == -1)
+    {
+        printf("**결과: 무승부**\n");
+    }
+    else
+    {
+        printf("**결과: 플레이어 %d 승리!**\n", session->game.winner);
+    }
+
+    // 시간 출력: 모두 서버 시계 기준, 입력 시간은 클라이언트가 보고한 값을 왕복 시간 이하로 자른 것
+    printf("1. 게임 실행 시간: %.3f seconds\n", total_runtime);
+    printf("2. 사용자 입력 시간: %.3f seconds\n", session->timings[SESSION_TIMING_THINK].total / 1e9);
+    printf("3. 서버 처리 시간: %.6f seconds\n", session->timings[SESSION_TIMING_SERVER].total / 1e9);
+    printf("4. 전달(IPC) 시간: %.6f seconds\n", session->timings[SESSION_TIMING_IPC].total / 1e9);
+    print_timings(session->timings);
+    fflush(stdout);
+}
+
+// 끝난 게임들의 시간 분포 합계 출력 (실행 중 언제든 호출 가능)
+void session_table_report(SessionTable *table)
+{
+    HdrHist *timings = malloc(sizeof(HdrHist) * SESSION_TIMINGS);
+    if (timings == NULL)
+        return;
+    pthread_mutex_lock(&table->timings_lock);
+    memcpy(timings, table->timings, sizeof(HdrHist) * SESSION_TIMINGS);
+    long games = table->timed_games;
+    pthread_mutex_unlock(&table->timings_lock);
+
+    printf("**시간 분포: 끝난 게임 %ld / %d**\n", games, table->count);
+    print_timings(timings);
+    fflush(stdout);
+    free(timings);
+}
@@ -0,0 +1,147 @@
+// pipe_session.h
+#ifndef PIPE_SESSION_H
+#define PIPE_SESSION_H
+
+#include <pthread.h>
+#include <semaphore.h>
+#include <stddef.h>
+#include <time.h>
+#include "ttt_engine.h"
+#include "mnk_board.h"
+#include "mnk_search.h"
+#include "wire.h"
+#include "work_pool.h"
+#include "hdr_hist.h"
+#include "state_file.h"
+
+#define MAX_CLIENTS 2 // 세션당 클라이언트 수
+#define PIPE_READ 0   // 파이프 인덱스
+#define PIPE_WRITE 1  // 파이프 인덱스
+#define SESSION_PATH_MAX 256
+#define SESSION_EVENT_BATCH 64 // 풀 모드: epoll_wait 한 번에 받는 이벤트 수
+#define SESSION_BOT_THINK_MS 1000 // 서버 봇의 수당 탐색 시간 (3x3 보다 큰 게임판)
+
+// 서버가 직접 잰 시각으로 나눈 한 수의 시간 구간
+enum
+{
+    SESSION_TIMING_THINK,  // 생각 시간: 클라이언트가 보고한 입력 시간 (서버가 잰 왕복 시간 이하로 제한)
+    SESSION_TIMING_IPC,    // IPC 지연: 차례 알림부터 수 도착까지의 왕복 - 생각 시간
+    SESSION_TIMING_SERVER, // 서버 처리: 수 도착부터 다음 차례 알림(또는 게임 종료) 작성까지
+    SESSION_TIMINGS
+};
+
+// 세션별 FIFO 이름 형식 (디렉터리, 세션 ID, 플레이어 ID)
+#define CLIENT_FIFO_FORMAT "%s/s%d_client%d_fifo"
+#define SERVER_FIFO_FORMAT "%s/s%d_server%d_fifo"
+
+typedef struct // 게임 상태 구조체
+{
+    MnkBoard board; // 범용 m×n 게임판 (마지막 수 기준 k목 판정)
+    TttBoard bits;  // 3x3 3목일 때의 비트보드 (board 와 함께 갱신)
+    int classic;    // 3x3 3목이면 1: 비트보드로 판정
+    int turn;       // 현재 턴인 플레이어 ID (0 또는 1)
+    int winner;     // -1: 게임 진행 중, 0 또는 1: 승자, 2: 무승부
+    int last_row, last_col; // 마지막으로 둔 수 (-1: 아직 없음)
+    int win_line;   // 3x3 3목: 마지막 판정에서 완성된 줄 (0~7, -1: 없음)
+} GameState;
+
+struct GameSession;
+struct SessionTable;
+
+typedef struct // 클라이언트 정보 구조체
+{
+    int id;
+    int pipe_fd[2];  // [읽기, 쓰기]
+    sem_t turn_sem;  // 세션 내부 차례 신호 (이름 없는 세마포어)
+    WireReader reader; // 클라이언트 FIFO 수신 재조립 버퍼
+    WorkTask task;     // 풀 모드: 클라이언트 FIFO 를 읽을 수 있을 때 작업자가 실행
+    int ready;         // 접속을 확인함 (풀 모드는 첫 이벤트부터, 그 전에 보낸 차례는 왕복을 재지 않음)
+    uint64_t turn_sent_ns; // 마지막 차례 알림 시각 (0: 모름)
+    struct GameSession *session;
+    char fifo_name[SESSION_PATH_MAX];   // 클라이언트 -> 서버
+    char server_fifo[SESSION_PATH_MAX]; // 서버 -> 클라이언트
+} ClientInfo;
+
+typedef struct GameSession // 한 판의 게임에 필요한 모든 상태
+{
+    int id;
+    GameState game;
+    pthread_mutex_t game_mutex; // 게임 상태 보호를 위한 뮤텍스
+    uint64_t locked_ns;         // game_mutex 를 잡은 시각 (보유 시간 통계, 잠금이 보호함)
+    ClientInfo clients[MAX_CLIENTS];
+    struct timespec game_start_time, game_end_time; // 게임 시작 및 종료 시간
+    HdrHist timings[SESSION_TIMINGS];               // 서버가 잰 수별 시간 분포 (game_mutex 가 보호)
+    uint64_t arrival_ns;                            // 처리 중인 수의 도착 시각 (0: 없음)
+    volatile int game_over_flag;                    // 게임 종료 플래그
+    int moves;                                      // 성공한 수의 개수
+    int verbose;                                    // 콘솔 로그 출력 여부
+    int bot_player;                                 // 서버 봇이 두는 플레이어 (-1: 없음)
+    struct GameSession *bot_next;                   // 봇 탐색 대기열의 다음 세션 (테이블의 bot_lock 이 보호)
+    int restored_over;                              // 상태 파일에서 이미 끝난 게임으로 복원됨 (접속을 기다리지 않음)
+    size_t stack_size;                              // 세션 스레드 스택 크기 (0: 기본값)
+    struct SessionTable *table;                     // 풀 모드: 이벤트 처리에 필요한 테이블
+} GameSession;
+
+typedef struct // 세션 테이블 설정
+{
+    int count;         // 세션 수
+    const char *dir;   // FIFO 생성 디렉터리
+    int verbose;       // 콘솔 로그 출력 여부
+    size_t stack_size; // 세션 스레드 스택 크기 (0: 기본값)
+    int rows, cols, k; // 게임판 크기와 승리 조건 (기본 3x3, 3목)
+    int workers;       // 작업자 풀 크기 (0: 세션마다 스레드, 클라이언트마다 핸들러 스레드)
+    int bot_player;    // 서버가 두는 플레이어 (-1: 없음, 3x3 은 미리 푼 표, 그 외는 병렬 탐색)
+    int bot_think_ms;  // 서버 봇의 수당 탐색 시간 (3x3 보다 큰 게임판)
+    int bot_threads;   // 서버 봇의 탐색 스레드 수 (기본: CPU 수)
+    StateFile *state;  // 게임 상태를 저장할 파일 (NULL: 저장하지 않음), 저장된 세션은 init 에서 이어 둠
+} SessionConfig;
+
+// 세션 테이블: 한 서버 프로세스가 관리하는 N개의 게임
+//  풀 모드(workers > 0)에서는 세션 수와 관계없이 이벤트 대기 스레드 하나와 작업자 workers 개만 사용
+//  이벤트 대기 스레드가 읽을 수 있는 클라이언트 FIFO 를 작업자 풀에 넣고, 작업자가 수를 처리
+typedef struct SessionTable
+{
+    int count;
+    char dir[SESSION_PATH_MAX]; // FIFO 생성 디렉터리
+    GameSession *sessions;
+    pthread_t *threads;
+    int workers;
+    WorkPool pool;
+    int epoll_fd;               // 풀 모드: 모든 클라이언트 FIFO (EPOLLONESHOT)
+    int wake_fd;                // 풀 모드: 마지막 세션이 끝나면 이벤트 대기 스레드를 깨우는 eventfd
+    pthread_t poller;
+    atomic_int finished;        // 풀 모드: 끝난 세션 수
+    HdrHist timings[SESSION_TIMINGS]; // 끝난 게임 전체의 시간 분포 (게임이 끝날 때 세션 분포를 합침)
+    long timed_games;
+    pthread_mutex_t timings_lock;
+    StateFile *state;           // 수마다 세션 상태를 저장하는 파일 (NULL: 없음)
+    int resumed;                // 상태 파일에서 이어 둔 진행 중 게임 수
+
+    // 서버 봇 (3x3 보다 큰 게임판): 봇 스레드 하나가 대기열의 세션을 차례로 game_mutex 밖에서 탐색하고 수를 둠
+    MnkSearch search;           // 모든 세션이 나눠 쓰는 탐색 엔진 (스레드 묶음은 init 에서 한 번 만듦)
+    int bot_search;             // search 를 만들었으면 1
+    int bot_think_ms;           // 수당 탐색 시간
+    pthread_t bot_thread;
+    int bot_started;
+    pthread_mutex_t bot_lock;   // 대기열 보호 (game_mutex 를 잡은 채로 잡을 수 있음, 반대는 안 됨)
+    pthread_cond_t bot_wake;
+    GameSession *bot_head, *bot_tail; // 봇 차례를 기다리는 세션
+    int bot_quit;
+} SessionTable;
+
+// 게임 규칙
+int init_game(GameState *game, int rows, int cols, int k);
+int check_result(GameState *game); // -1: 진행 중, 0 또는 1: 승자, 2: 무승부
+void describe_result(const GameState *game, char *buf, size_t size);
+int make_move(GameState *game, int player_id, int row, int col);
+
+// 세션 테이블 관리
+void session_config_default(SessionConfig *config);
+int session_table_init(SessionTable *table, const SessionConfig *config);
+int session_table_start(SessionTable *table);
+void session_table_join(SessionTable *table);
+void session_table_destroy(SessionTable *table);
+void session_print_result(const GameSession *session);
+void session_table_report(SessionTable *table); // 지금까지 끝난 게임 전체의 시간 분포 (언제든 호출 가능)
+
+#endif
@@ -0,0 +1,128 @@
+// shm_broadcast.h
+// 관전자용 방송 링: 서버(기록자 하나)가 게임판이 바뀔 때마다 프레임을 한 번만 쓰고, 관전자 여럿이 읽기 전용으로 매핑해 읽음
+//  발행(shm_broadcast_publish)은 관전자 수와 관계없이 프레임 한 번 쓰기 (관전자별 복사나 시스템 호출 없음)
+//  깨우기(shm_broadcast_notify)는 futex 한 번이지만 잠든 관전자를 모두 깨우는 커널 작업은 관전자 수에 비례하므로
+//  서버는 플레이어를 깨운 뒤에 따로 호출 (수 적용 경로에는 발행만 들어감)
+//  관전자는 아무것도 기록하지 않으므로 기록자가 관전자를 기다리는 일이 없음
+//  느린 관전자는 덮어쓴 프레임을 건너뛰고 최신 프레임부터 다시 읽음 (게임을 멈추지 않음)
+//  프레임마다 seqlock: 읽는 도중 덮어쓰였으면 다시 읽거나 건너뜀
+//  초기화 함수 없음: 새 세그먼트는 0 으로 채워져 있고, 죽은 서버의 세그먼트를 다시 쓸 때는
+//  프레임 번호를 이어 가야 붙어 있던 관전자가 헷갈리지 않음
+#ifndef SHM_BROADCAST_H
+#define SHM_BROADCAST_H
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <limits.h>
+#include <unistd.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include "ttt_engine.h"
+#include "shm_ring.h"
+
+#define SHM_BROADCAST_KEY 60105  // 게임 세그먼트(SHM_KEY) 와 별도 세그먼트 (관전자는 SHM_RDONLY 로 붙음)
+#define SHM_BROADCAST_SLOTS 64   // 2의 거듭제곱, 관전자가 이만큼 뒤처지면 건너뜀
+#define SHM_BROADCAST_MASK (SHM_BROADCAST_SLOTS - 1)
+
+typedef struct {
+    _Atomic uint32_t seq;  // 프레임 seqlock (홀수: 기록 중)
+    uint32_t number;       // 이 칸에 마지막으로 쓴 프레임 번호 (덮어쓰였는지 확인용)
+    TttBoard board;
+    int32_t turn;
+    int32_t game_over;
+    int32_t winner;        // -1: 진행 중 또는 무승부, 0 또는 1: 승자
+    int32_t move_count;
+    int32_t last_cell;     // 마지막으로 둔 칸 (-1: 없음)
+    uint64_t published_ns; // 발행 시각 (CLOCK_MONOTONIC, 지연 측정용)
+} ShmFrame;
+
+typedef struct {
+    _Alignas(SHM_CACHE_LINE) _Atomic uint32_t head; // 다음에 발행할 프레임 번호 (futex 단어 겸용, 기록자만 증가)
+    _Alignas(SHM_CACHE_LINE) ShmFrame frames[SHM_BROADCAST_SLOTS];
+} ShmBroadcast;
+
+// 프레임 하나 발행 (기록자 하나만 호출, 시스템 호출 없음)
+static inline void shm_broadcast_publish(ShmBroadcast* bc, const ShmFrame* frame) {
+    uint32_t number = atomic_load_explicit(&bc->head, memory_order_relaxed);
+    ShmFrame* slot = &bc->frames[number & SHM_BROADCAST_MASK];
+    uint32_t seq = atomic_load_explicit(&slot->seq, memory_order_relaxed);
+    atomic_store_explicit(&slot->seq, seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    slot->number = number;
+    slot->board = frame->board;
+    slot->turn = frame->turn;
+    slot->game_over = frame->game_over;
+    slot->winner = frame->winner;
+    slot->move_count = frame->move_count;
+    slot->last_cell = frame->last_cell;
+    slot->published_ns = frame->published_ns;
+    atomic_store_explicit(&slot->seq, seq + 2, memory_order_release);
+    atomic_store_explicit(&bc->head, number + 1, memory_order_release);
+}
+
+// 잠든 관전자 모두 깨움 (프레임을 여러 개 발행한 뒤 한 번만 불러도 됨)
+//  관전자는 읽기 전용이라 대기자 수를 셀 수 없으므로 항상 futex 를 호출
+static inline void shm_broadcast_notify(ShmBroadcast* bc) {
+    syscall(SYS_futex, &bc->head, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+}
+
+// 관전자 쪽 읽기 위치
+typedef struct {
+    uint32_t next;    // 다음에 읽을 프레임 번호
+    uint64_t skipped; // 뒤처져 건너뛴 프레임 수
+} ShmBroadcastCursor;
+
+// 가장 최근 프레임부터 읽도록 위치 지정 (아직 발행된 프레임이 없으면 첫 프레임부터)
+static inline void shm_broadcast_attach(ShmBroadcast* bc, ShmBroadcastCursor* cursor) {
+    uint32_t head = atomic_load_explicit(&bc->head, memory_order_acquire);
+    cursor->next = head > 0 ? head - 1 : 0;
+    cursor->skipped = 0;
+}
+
+// 다음 프레임 복사 (1: 읽음, 0: 새 프레임 없음)
+//  링 한 바퀴 이상 뒤처졌으면 최신 프레임으로 건너뛰고 건너뛴 수를 셈
+static inline int shm_broadcast_read(ShmBroadcast* bc, ShmBroadcastCursor* cursor, ShmFrame* out) {
+    for (;;) {
+        uint32_t head = atomic_load_explicit(&bc->head, memory_order_acquire);
+        if (head == cursor->next) {
+            return 0;
+        }
+        if (head - cursor->next > SHM_BROADCAST_SLOTS) {
+            cursor->skipped += head - 1 - cursor->next;
+            cursor->next = head - 1;
+        }
+        const ShmFrame* slot = &bc->frames[cursor->next & SHM_BROADCAST_MASK];
+        uint32_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        if (seq & 1) {
+            // 이 칸을 다시 쓰는 중 (기록이 끝나면 head 가 앞서 있으므로 다음 반복에서 건너뜀)
+            sched_yield();
+            continue;
+        }
+        out->number = slot->number;
+        out->board = slot->board;
+        out->turn = slot->turn;
+        out->game_over = slot->game_over;
+        out->winner = slot->winner;
+        out->move_count = slot->move_count;
+        out->last_cell = slot->last_cell;
+        out->published_ns = slot->published_ns;
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&slot->seq, memory_order_relaxed) != seq || out->number != cursor->next) {
+            // 읽는 동안 덮어쓰임: 기록자가 head 를 올린 뒤 다시 보고 건너뜀
+            sched_yield();
+            continue;
+        }
+        cursor->next++;
+        return 1;
+    }
+}
+
+// 새 프레임이 발행될 때까지 잠듦 (읽기 전용 매핑에서도 FUTEX_WAIT 는 가능)
+static inline void shm_broadcast_wait(ShmBroadcast* bc, const ShmBroadcastCursor* cursor) {
+    uint32_t head = atomic_load_explicit(&bc->head, memory_order_acquire);
+    if (head == cursor->next) {
+        syscall(SYS_futex, &bc->head, FUTEX_WAIT, head, NULL, NULL, 0);
+    }
+}
+
+#endif
@@ -0,0 +1,140 @@
+// shm_common.h
+// shmserver.c / shmclient.c 가 공유하는 공유 메모리 구조 (세그먼트 하나에 게임 슬롯 여러 개)
+#ifndef SHM_COMMON_H
+#define SHM_COMMON_H
+
+#include "ttt_engine.h"
+#include "shm_ring.h"
+#include "shm_event.h"
+#include "shm_seqlock.h"
+
+#define SHM_KEY 60104      // 공유 메모리 키를 60103으로 설정
+#define SHM_BOARD_SIZE TTT_CELLS // pipe 쪽 BOARD_SIZE(3x3의 한 변)와 겹치지 않도록 접두사 사용
+#define SHM_MAX_CLIENTS 2
+#define SHM_MAX_GAMES 128  // 세그먼트 하나의 게임 슬롯 수 (서버는 앞에서부터 -g 개를 엶)
+#define SHM_SEAT_WORDS (SHM_MAX_GAMES * SHM_MAX_CLIENTS / 64) // 자리 비트맵 단어 수
+#define SHM_MAGIC 0x7474746du // "tttm": 서버가 세그먼트 초기화를 마침
+#define SHM_SEATS_FULL ((1u << SHM_MAX_CLIENTS) - 1)
+
+// 게임 슬롯 하나: 한 판에 필요한 상태와 동기화 단어를 모두 슬롯 안에 둠
+//  슬롯은 캐시 라인 경계에서 시작하므로 다른 슬롯의 수는 같은 캐시 라인이나 잠금을 건드리지 않음
+//  서버 쪽은 고정된 수의 관리 스레드가 슬롯을 나누어 맡음 (슬롯 수와 관계없이 스레드 수 일정)
+typedef struct {
+    _Alignas(SHM_CACHE_LINE) ShmSeqlock state_lock; // board/turn/game_over/winner/move_count 보호 (기록자는 서버 하나)
+    TttBoard board; // 플레이어별 9비트 마스크 (ttt_engine)
+    int turn;       // 현재 차례: 0 또는 1
+    int game_over;  // 게임 종료 여부
+    int winner;     // 승자: -1(무승부), 0 또는 1
+    int move_count; // 지금까지 둔 수
+    _Atomic uint32_t seats; // 앉은 자리 (bit p: 플레이어 p), 자리는 헤더의 비트맵에서 차지한 뒤 여기에 표시
+    int manager;            // 이 슬롯을 맡은 서버 관리 스레드 (헤더의 doorbells 번호)
+
+    // 수 요청 경로 (잠금 없음): 클라이언트가 링에 넣고, 서버만 검증 후 게임판에 적용
+    ShmRing commands[SHM_MAX_CLIENTS];                // 클라이언트별 명령 링
+    _Atomic uint32_t ack_seq[SHM_MAX_CLIENTS];        // 서버가 마지막으로 처리한 요청 번호
+    _Atomic int ack_result[SHM_MAX_CLIENTS];          // 그 요청의 결과 (0: 적용, -1: 거부)
+
+    // 대기/깨우기 (futex): 필요한 쪽만 깨움 (서버 쪽은 shm_game_notify 로 관리 스레드의 doorbell)
+    ShmEvent player_event[SHM_MAX_CLIENTS]; // 서버 -> 플레이어: 요청 처리, 차례 시작, 게임 종료
+    ShmEvent board_event;                   // 게임판 세대 (수가 적용되거나 게임이 끝날 때마다 증가)
+} ShmGame;
+
+// 세그먼트: 머리 정보와 자리 비트맵, 그 뒤에 게임 슬롯 배열
+//  클라이언트는 전역 잠금 없이 비트맵에서 빈 자리 비트를 CAS 로 지워 자리를 차지함
+typedef struct {
+    _Atomic uint32_t magic; // SHM_MAGIC: 서버가 슬롯과 비트맵을 모두 초기화함 (마지막에 기록)
+    int game_count;         // 서버가 연 슬롯 수
+    int manager_count;      // 슬롯을 나누어 맡는 서버 관리 스레드 수 (슬롯 s 는 s % manager_count 번)
+    _Atomic uint64_t free_seats[SHM_SEAT_WORDS]; // 빈 자리 비트맵: 자리 번호 slot * 2 + player 의 비트가 1 이면 빈 자리
+    ShmEvent doorbells[SHM_MAX_GAMES]; // 클라이언트 -> 서버: 관리 스레드마다 하나, 맡은 슬롯에 자리나 요청이 생김
+    ShmEvent lobby_event; // 서버 -> 자리를 기다리는 클라이언트: 끝난 슬롯을 다시 열었거나 서버가 끝남 (magic 이 0)
+    ShmGame games[SHM_MAX_GAMES];
+} SharedMemory;
+
+_Static_assert(sizeof(ShmGame) % SHM_CACHE_LINE == 0, "game slots must not share cache lines");
+_Static_assert(SHM_MAX_GAMES * SHM_MAX_CLIENTS % 64 == 0, "seat bitmap must fill whole words");
+
+// 슬롯을 맡은 서버 관리 스레드 깨우기 (자리에 앉았거나 명령 링에 요청을 넣은 뒤)
+static inline void shm_game_notify(SharedMemory* shm, ShmGame* game) {
+    shm_event_signal(&shm->doorbells[game->manager]);
+}
+
+// mask 에 포함된 빈 자리 하나를 잠금 없이 차지 (낮은 번호부터, 앞 슬롯의 남은 자리를 먼저 채움)
+//  차지한 자리는 슬롯의 seats 에 표시하고 그 슬롯을 맡은 관리 스레드만 깨움
+//  반환: 자리 번호 (slot * 2 + player), 빈 자리가 없으면 -1
+static inline int shm_claim_seat(SharedMemory* shm, const uint64_t mask[SHM_SEAT_WORDS]) {
+    for (int w = 0; w < SHM_SEAT_WORDS; w++) {
+        uint64_t seats = atomic_load_explicit(&shm->free_seats[w], memory_order_acquire);
+        while ((seats & mask[w]) != 0) {
+            int bit = __builtin_ctzll(seats & mask[w]);
+            if (atomic_compare_exchange_weak_explicit(&shm->free_seats[w], &seats, seats & ~(1ull << bit),
+                                                      memory_order_acq_rel, memory_order_acquire)) {
+                int seat = w * 64 + bit;
+                ShmGame* game = &shm->games[seat / SHM_MAX_CLIENTS];
+                atomic_fetch_or(&game->seats, 1u << (seat % SHM_MAX_CLIENTS));
+                shm_game_notify(shm, game);
+                return seat;
+            }
+        }
+    }
+    return -1;
+}
+
+// 끝난 게임의 자리를 비움 (빈 자리 비트맵에는 서버가 슬롯을 새 게임으로 초기화한 뒤에 돌려놓음)
+//  두 자리가 모두 비어야 서버가 슬롯을 다시 열므로, 비운 뒤에는 그 슬롯을 읽지 않음
+static inline void shm_leave_seat(SharedMemory* shm, int seat) {
+    ShmGame* game = &shm->games[seat / SHM_MAX_CLIENTS];
+    atomic_fetch_and(&game->seats, ~(1u << (seat % SHM_MAX_CLIENTS)));
+    shm_game_notify(shm, game);
+}
+
+// 빈 자리가 생길 때까지 기다렸다가 차지 (끝난 게임의 플레이어가 다시 줄을 설 때)
+//  반환: 자리 번호, 서버가 더 이상 게임을 열지 않고 끝났으면 -1
+static inline int shm_wait_seat(SharedMemory* shm, const uint64_t mask[SHM_SEAT_WORDS]) {
+    for (;;) {
+        uint32_t seen = shm_event_prepare(&shm->lobby_event);
+        if (atomic_load_explicit(&shm->magic, memory_order_acquire) != SHM_MAGIC) {
+            return -1;
+        }
+        int seat = shm_claim_seat(shm, mask);
+        if (seat != -1) {
+            return seat;
+        }
+        shm_event_wait(&shm->lobby_event, seen);
+    }
+}
+
+// shm_claim_seat 용 자리 마스크: slot 이 -1 이면 모든 슬롯, 아니면 그 슬롯의 두 자리
+static inline void shm_seat_mask(int slot, uint64_t mask[SHM_SEAT_WORDS]) {
+    for (int w = 0; w < SHM_SEAT_WORDS; w++) {
+        mask[w] = slot == -1 ? ~0ull : 0;
+    }
+    if (slot != -1) {
+        int seat = slot * SHM_MAX_CLIENTS;
+        mask[seat / 64] |= (uint64_t)SHM_SEATS_FULL << (seat % 64);
+    }
+}
+
+// 관찰자용 게임 상태 복사본
+typedef struct {
+    TttBoard board;
+    int turn;
+    int game_over;
+    int winner;
+    int move_count;
+} ShmGameView;
+
+// 잠금 없이 일관된 게임 상태 복사 (서버의 기록 도중이었으면 다시 읽음)
+static inline void shm_state_snapshot(ShmGame* game, ShmGameView* view) {
+    uint32_t seq;
+    do {
+        seq = shm_seqlock_read_begin(&game->state_lock);
+        view->board = game->board;
+        view->turn = game->turn;
+        view->game_over = game->game_over;
+        view->winner = game->winner;
+        view->move_count = game->move_count;
+    } while (shm_seqlock_read_retry(&game->state_lock, seq));
+}
+
+#endif
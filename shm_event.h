@@ -0,0 +1,73 @@
+// shm_event.h
+// 프로세스 간 futex 이벤트 (공유 메모리 안에 둠)
+//  seq 는 신호마다 증가하는 32비트 단어로 futex 대기 주소로 쓰임
+//  대기자가 없으면 신호 쪽은 시스템 호출 없이 seq 만 증가시킴
+//  사용법:
+//      for (;;) {
+//          uint32_t seen = shm_event_prepare(ev);
+//          if (조건) break;
+//          shm_event_wait(ev, seen);
+//      }
+#ifndef SHM_EVENT_H
+#define SHM_EVENT_H
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <limits.h>
+#include <unistd.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include "shm_ring.h"
+
+#define SHM_SPIN_LIMIT 200 // futex 로 잠들기 전 확인 횟수 (CPU가 둘 이상일 때만)
+
+typedef struct {
+    _Alignas(SHM_CACHE_LINE) _Atomic uint32_t seq; // 신호마다 증가 (futex 단어)
+    _Atomic uint32_t waiters;                      // futex 에서 잠든 대기자 수
+} ShmEvent;
+
+static inline void shm_event_init(ShmEvent* ev) {
+    atomic_store(&ev->seq, 0);
+    atomic_store(&ev->waiters, 0);
+}
+
+// 조건을 확인하기 전에 현재 seq 를 읽어 둠 (확인 후 신호가 와도 놓치지 않음)
+static inline uint32_t shm_event_prepare(ShmEvent* ev) {
+    return atomic_load_explicit(&ev->seq, memory_order_acquire);
+}
+
+// 단일 CPU에서는 상대가 실행될 수 없으므로 돌지 않고 바로 잠듦
+static inline int shm_spin_limit(void) {
+    static int limit = -1;
+    if (limit < 0) {
+        limit = sysconf(_SC_NPROCESSORS_ONLN) > 1 ? SHM_SPIN_LIMIT : 0;
+    }
+    return limit;
+}
+
+// seq 가 seen 에서 바뀔 때까지 대기 (짧게 돌다가 futex 로 잠듦)
+static inline void shm_event_wait(ShmEvent* ev, uint32_t seen) {
+    int limit = shm_spin_limit();
+    for (int i = 0; i < limit; i++) {
+        if (atomic_load_explicit(&ev->seq, memory_order_acquire) != seen) {
+            return;
+        }
+        SHM_CPU_RELAX();
+    }
+    atomic_fetch_add(&ev->waiters, 1);
+    // seq 가 이미 바뀌었으면 커널이 EAGAIN 으로 바로 돌려줌
+    if (atomic_load(&ev->seq) == seen) {
+        syscall(SYS_futex, &ev->seq, FUTEX_WAIT, seen, NULL, NULL, 0);
+    }
+    atomic_fetch_sub(&ev->waiters, 1);
+}
+
+// 신호: seq 증가 후 잠든 대기자가 있을 때만 깨움
+static inline void shm_event_signal(ShmEvent* ev) {
+    atomic_fetch_add(&ev->seq, 1);
+    if (atomic_load(&ev->waiters) > 0) {
+        syscall(SYS_futex, &ev->seq, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+    }
+}
+
+#endif
@@ -0,0 +1,84 @@
+// shm_ring.h
+// 공유 메모리 안에 두는 단일 생산자/단일 소비자(SPSC) 명령 링
+//  생산자(클라이언트)는 head 만, 소비자(서버)는 tail 만 기록하므로 잠금이 필요 없음
+//  head/tail 을 서로 다른 캐시 라인에 두어 두 프로세스가 같은 라인을 번갈아 빼앗지 않도록 함
+#ifndef SHM_RING_H
+#define SHM_RING_H
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <sched.h>
+#include <time.h>
+
+#define SHM_CACHE_LINE 64
+#define SHM_RING_SLOTS 16 // 2의 거듭제곱 (인덱스는 & 로 감쌈)
+#define SHM_RING_MASK (SHM_RING_SLOTS - 1)
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SHM_CPU_RELAX() __builtin_ia32_pause()
+#else
+#define SHM_CPU_RELAX() __asm__ __volatile__("" ::: "memory")
+#endif
+
+typedef struct {
+    int32_t cell;     // 둘 칸 (0~8)
+    uint32_t seq;     // 요청 번호 (클라이언트가 1부터 증가, 서버가 ack_seq 로 돌려줌)
+    uint64_t sent_ns; // 보낸 시각 (CLOCK_MONOTONIC, 지연 측정용)
+} ShmCommand;
+
+typedef struct {
+    _Alignas(SHM_CACHE_LINE) _Atomic uint32_t head; // 다음에 쓸 위치 (생산자만 기록)
+    _Alignas(SHM_CACHE_LINE) _Atomic uint32_t tail; // 다음에 읽을 위치 (소비자만 기록)
+    _Alignas(SHM_CACHE_LINE) ShmCommand slots[SHM_RING_SLOTS];
+} ShmRing;
+
+static inline void shm_ring_init(ShmRing* ring) {
+    atomic_store_explicit(&ring->head, 0, memory_order_relaxed);
+    atomic_store_explicit(&ring->tail, 0, memory_order_relaxed);
+}
+
+// 명령 하나 추가 (0: 성공, -1: 링이 가득 참)
+static inline int shm_ring_push(ShmRing* ring, const ShmCommand* cmd) {
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    if (head - tail == SHM_RING_SLOTS) {
+        return -1;
+    }
+    ring->slots[head & SHM_RING_MASK] = *cmd;
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release); // 슬롯 내용을 먼저 공개
+    return 0;
+}
+
+// 명령 하나 꺼냄 (1: 꺼냄, 0: 비어 있음)
+static inline int shm_ring_pop(ShmRing* ring, ShmCommand* cmd) {
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    if (tail == head) {
+        return 0;
+    }
+    *cmd = ring->slots[tail & SHM_RING_MASK];
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release); // 슬롯을 생산자에게 반환
+    return 1;
+}
+
+static inline int shm_ring_empty(ShmRing* ring) {
+    return atomic_load_explicit(&ring->tail, memory_order_relaxed) ==
+        atomic_load_explicit(&ring->head, memory_order_acquire);
+}
+
+// 대기 중 점진적 양보: 짧게 돌고, 다음엔 CPU 를 양보하고, 오래 걸리면 잠깐 잠듦
+static inline void shm_backoff(unsigned* spins) {
+    if (*spins < 64) {
+        SHM_CPU_RELAX();
+    }
+    else if (*spins < 128) {
+        sched_yield();
+    }
+    else {
+        struct timespec ts = { 0, 50000 }; // 50us
+        nanosleep(&ts, NULL);
+    }
+    (*spins)++;
+}
+
+#endif
@@ -0,0 +1,62 @@
+// shm_seqlock.h
+// 단일 기록자 seqlock: 읽는 쪽은 잠금 없이 일관된 복사본을 얻고, 기록자는 읽는 쪽을 기다리지 않음
+//  seq 가 홀수면 기록 중, 읽기 전후의 seq 가 다르면 그 사이에 기록이 있었으므로 다시 읽음
+//  사용법 (읽기):
+//      uint32_t seq;
+//      do {
+//          seq = shm_seqlock_read_begin(lock);
+//          ... 복사 ...
+//      } while (shm_seqlock_read_retry(lock, seq));
+#ifndef SHM_SEQLOCK_H
+#define SHM_SEQLOCK_H
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <sched.h>
+#include "shm_ring.h"
+
+#define SHM_SEQLOCK_SPINS 100 // 기록이 끝나길 기다리며 도는 횟수 (넘으면 CPU 양보)
+
+typedef struct {
+    _Atomic uint32_t seq;
+} ShmSeqlock;
+
+static inline void shm_seqlock_init(ShmSeqlock* lock) {
+    atomic_store(&lock->seq, 0);
+}
+
+// 기록 시작 (seq 홀수) - 이후의 기록이 seq 증가보다 먼저 보이지 않도록 release 펜스
+static inline void shm_seqlock_write_begin(ShmSeqlock* lock) {
+    uint32_t seq = atomic_load_explicit(&lock->seq, memory_order_relaxed);
+    atomic_store_explicit(&lock->seq, seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+}
+
+// 기록 끝 (seq 짝수) - 기록한 내용을 seq 와 함께 공개
+static inline void shm_seqlock_write_end(ShmSeqlock* lock) {
+    uint32_t seq = atomic_load_explicit(&lock->seq, memory_order_relaxed);
+    atomic_store_explicit(&lock->seq, seq + 1, memory_order_release);
+}
+
+// 읽기 시작: 기록 중이면 끝날 때까지 기다림 (기록자가 선점당했으면 CPU 양보)
+static inline uint32_t shm_seqlock_read_begin(ShmSeqlock* lock) {
+    uint32_t seq;
+    int spins = 0;
+    while ((seq = atomic_load_explicit(&lock->seq, memory_order_acquire)) & 1) {
+        if (++spins > SHM_SEQLOCK_SPINS) {
+            sched_yield();
+        }
+        else {
+            SHM_CPU_RELAX();
+        }
+    }
+    return seq;
+}
+
+// 읽는 동안 기록이 있었으면 1 (복사본을 버리고 다시 읽어야 함)
+static inline int shm_seqlock_read_retry(ShmSeqlock* lock, uint32_t seq) {
+    atomic_thread_fence(memory_order_acquire);
+    return atomic_load_explicit(&lock->seq, memory_order_relaxed) != seq;
+}
+
+#endif
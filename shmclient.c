@@ -4,140 +4,180 @@
 #include <sys/ipc.h>
 #include <sys/shm.h>
 #include <unistd.h>
+#include <time.h>
+#include "shm_common.h"
+#include "shm_broadcast.h"
+#include "term_render.h"
 
-#define SHM_KEY 60104      
-#define BOARD_SIZE 9
-
-typedef struct {
-    char board[BOARD_SIZE];
-    int turn;       // 현재 차례: 0 또는 1
-    int game_over;  // 게임 종료 여부
-    int winner;     // 승자: -1(무승부), 0 또는 1
-    int client_count;
-    int ready[2];
-    pthread_mutex_t mutex;
-    pthread_cond_t cond;
-} SharedMemory;
-
-SharedMemory* shared_mem;
+#define BOARD_SIZE SHM_BOARD_SIZE
+#define MAX_CLIENTS SHM_MAX_CLIENTS
+
+SharedMemory* shared_mem; // 세그먼트 (머리 정보 + 게임 슬롯 배열)
+ShmGame* game;            // 이 클라이언트가 앉은 게임 슬롯
+int slot_id;
 int player_id;
 
-void print_board() {
-    printf("\n");
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        printf(" %c ", shared_mem->board[i]);
-        if ((i + 1) % 3 == 0) {
-            printf("\n");
-            if (i < 6) printf("---+---+---\n");
-        }
-        else {
-            printf("|");
-        }
-    }
-    printf("\n");
-}
+TermRender render; // 입력 스레드와 화면 갱신 스레드가 함께 사용
 
 void* input_thread(void* arg) {
-    while (!shared_mem->game_over) {
-        pthread_mutex_lock(&shared_mem->mutex);
-
-        // 자신의 차례인지 확인
-        while (shared_mem->turn != player_id && !shared_mem->game_over) {
-            pthread_cond_wait(&shared_mem->cond, &shared_mem->mutex);
+    (void)arg;
+    uint32_t seq = 0; // 요청 번호
+    ShmEvent* my_event = &game->player_event[player_id];
+    while (!game->game_over) {
+        // 자신의 차례가 될 때까지 대기 (서버가 이 플레이어만 깨움)
+        for (;;) {
+            uint32_t seen = shm_event_prepare(my_event);
+            if (game->turn == player_id || game->game_over) {
+                break;
+            }
+            shm_event_wait(my_event, seen);
         }
 
-        if (shared_mem->game_over) {
-            pthread_mutex_unlock(&shared_mem->mutex);
+        if (game->game_over) {
             break;
         }
 
-        // 현재 보드 상태 출력
-        system("clear");
-        printf("플레이어 %d의 차례입니다.\n", player_id);
-        print_board();
-
-        // 사용자 입력 받기
+        // 사용자 입력 받기 (게임판은 화면 갱신 스레드가 그림)
+        term_render_prompt(&render);
         int pos;
         printf("위치 선택 (1-9): ");
+        fflush(stdout);
         if (scanf("%d", &pos) != 1) {
             printf("유효한 숫자를 입력하세요.\n");
             // 입력 버퍼 클리어
             while (getchar() != '\n');
-            pthread_mutex_unlock(&shared_mem->mutex);
             continue;
         }
         pos--;
 
-        if (pos < 0 || pos >= BOARD_SIZE || shared_mem->board[pos] != ' ') {
-            printf("잘못된 위치입니다. 다시 시도하세요.\n");
-        }
-        else {
-            shared_mem->board[pos] = (player_id == 0) ? 'X' : 'O';
-            shared_mem->turn = (player_id + 1) % 2; // 턴 전환
-            pthread_cond_broadcast(&shared_mem->cond); // 다른 플레이어에게 알림
+        // 서버에 수 요청 (검증과 적용은 서버가 담당)
+        ShmCommand cmd = { .cell = pos, .seq = ++seq };
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        cmd.sent_ns = (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+        if (shm_ring_push(&game->commands[player_id], &cmd) == -1) {
+            printf("서버가 요청을 처리하지 못하고 있습니다. 다시 시도하세요.\n");
+            continue;
         }
+        shm_game_notify(shared_mem, game);
 
-        pthread_mutex_unlock(&shared_mem->mutex);
-        usleep(100000); // 0.1초 대기
+        // 서버의 처리 결과 대기
+        for (;;) {
+            uint32_t seen = shm_event_prepare(my_event);
+            if (atomic_load_explicit(&game->ack_seq[player_id], memory_order_acquire) == seq ||
+                game->game_over) {
+                break;
+            }
+            shm_event_wait(my_event, seen);
+        }
+        if (atomic_load_explicit(&game->ack_result[player_id], memory_order_relaxed) == -1) {
+            printf("잘못된 위치입니다. 다시 시도하세요.\n");
+        }
     }
     return NULL;
 }
 
-void* update_thread(void* arg) {
-    while (!shared_mem->game_over) {
-        pthread_mutex_lock(&shared_mem->mutex);
+// 현재 상태를 그림 (바뀐 칸과 상태 줄만), 게임이 끝났으면 1 반환
+int render_state(uint32_t generation) {
+    char status[TERM_STATUS_MAX];
+    ShmGameView view;
+    shm_state_snapshot(game, &view); // 서버의 수 적용을 막지 않는 복사
+    if (view.game_over) {
+        snprintf(status, sizeof(status), "게임 종료");
+    }
+    else if (view.turn == player_id) {
+        snprintf(status, sizeof(status), "플레이어 %d의 차례입니다.", player_id);
+    }
+    else {
+        snprintf(status, sizeof(status), "상대방의 차례입니다. 대기 중...");
+    }
+    term_render_update(&render, generation, &view.board, status);
+    return view.game_over;
+}
 
-        // 자신의 차례가 아닐 때 보드 업데이트 확인
-        if (shared_mem->turn != player_id) {
-            system("clear");
-            printf("상대방의 차례입니다. 대기 중...\n");
-            print_board();
+// 게임판 세대가 바뀔 때만 깨어나 다시 그림 (게임 잠금 없이)
+void* update_thread(void* arg) {
+    (void)arg;
+    for (;;) {
+        uint32_t generation = shm_event_prepare(&game->board_event);
+        if (render_state(generation)) {
+            break;
         }
-
-        pthread_mutex_unlock(&shared_mem->mutex);
-        sleep(1);
+        shm_event_wait(&game->board_event, generation);
     }
     return NULL;
 }
 
-
-
-int main() {
-    int shm_id = shmget(SHM_KEY, sizeof(SharedMemory), 0666);
-
-    if (shm_id < 0) {
-        perror("shmget failed");
+// 관전 모드: 방송 세그먼트에 읽기 전용으로 붙어 서버가 발행한 프레임만 그림
+//  플레이어 자리와 게임 세그먼트는 건드리지 않으므로 관전자 수에 제한이 없고 게임을 늦추지 않음
+//  화면이 늦어 링 한 바퀴 이상 뒤처지면 최신 프레임으로 건너뜀
+int spectate(int slot) {
+    int broadcast_id = shmget(SHM_BROADCAST_KEY, 0, 0);
+    struct shmid_ds info;
+    if (broadcast_id < 0 || shmctl(broadcast_id, IPC_STAT, &info) == -1) {
+        perror("shmget broadcast failed");
         exit(1);
     }
-
-    shared_mem = (SharedMemory*)shmat(shm_id, NULL, 0);
-
-    if (shared_mem == (void*)-1) {
-        perror("shmat failed");
+    if (slot < 0 || (size_t)slot >= info.shm_segsz / sizeof(ShmBroadcast)) {
+        printf("게임 %d은 열려 있지 않습니다 (서버가 연 게임: %zu개).\n", slot, info.shm_segsz / sizeof(ShmBroadcast));
         exit(1);
     }
-
-    // 뮤텍스와 조건 변수를 초기화하지 않습니다.
-    // 클라이언트는 서버에서 초기화한 뮤텍스와 조건 변수를 사용합니다.
-
-    pthread_mutex_lock(&shared_mem->mutex);
-
-    // 클라이언트 수 체크 및 플레이어 ID 할당
-    if (shared_mem->client_count >= 2) {
-        printf("이미 최대 클라이언트 수에 도달했습니다.\n");
-        pthread_mutex_unlock(&shared_mem->mutex);
-        shmdt(shared_mem);
+    ShmBroadcast* broadcast = (ShmBroadcast*)shmat(broadcast_id, NULL, SHM_RDONLY);
+    if (broadcast == (void*)-1) {
+        perror("shmat broadcast failed");
         exit(1);
     }
+    broadcast += slot; // 이 게임의 링
 
-    player_id = shared_mem->client_count;
-    shared_mem->client_count++;
-    shared_mem->ready[player_id] = 1;
-    pthread_cond_broadcast(&shared_mem->cond); // 서버에 알림
+    ShmBroadcastCursor cursor;
+    shm_broadcast_attach(broadcast, &cursor);
+    term_render_init(&render);
+    ShmFrame frame;
+    for (;;) {
+        if (!shm_broadcast_read(broadcast, &cursor, &frame)) {
+            shm_broadcast_wait(broadcast, &cursor);
+            continue;
+        }
+        char status[TERM_STATUS_MAX];
+        if (frame.game_over) {
+            snprintf(status, sizeof(status), "관전 중 - 게임 종료 (%d수)", frame.move_count);
+        }
+        else {
+            snprintf(status, sizeof(status), "관전 중 - 플레이어 %d의 차례 (%d수)", frame.turn, frame.move_count);
+        }
+        term_render_update(&render, frame.number, &frame.board, status);
+        if (frame.game_over) {
+            break;
+        }
+    }
 
-    pthread_mutex_unlock(&shared_mem->mutex);
+    term_render_prompt(&render);
+    if (frame.winner == -1) {
+        printf("게임 결과: 무승부입니다!\n");
+    }
+    else {
+        printf("게임 결과: 플레이어 %d 승리!\n", frame.winner);
+    }
+    if (cursor.skipped > 0) {
+        printf("화면이 늦어 건너뛴 프레임: %lu개\n", (unsigned long)cursor.skipped);
+    }
+    term_render_destroy(&render);
+    shmdt(broadcast);
+    return 0;
+}
+
+// 자리 seat 에서 한 판: 입력 스레드와 화면 갱신 스레드를 띄우고 게임이 끝날 때까지 대기
+void play_game(int seat) {
+    slot_id = seat / MAX_CLIENTS;
+    player_id = seat % MAX_CLIENTS;
+    game = &shared_mem->games[slot_id];
+    if (shared_mem->game_count > 1) {
+        printf("게임 %d에 플레이어 %d로 앉았습니다.\n", slot_id, player_id);
+    }
 
     // 스레드 생성
+    term_render_init(&render);
+    render_state(shm_event_prepare(&game->board_event)); // 입력 안내보다 먼저 화면 틀을 그림
     pthread_t input_t, update_t;
     pthread_create(&input_t, NULL, input_thread, NULL);
     pthread_create(&update_t, NULL, update_thread, NULL);
@@ -146,20 +186,95 @@ int main() {
     pthread_join(input_t, NULL);
     pthread_join(update_t, NULL);
 
-    // 게임 결과 출력
-    pthread_mutex_lock(&shared_mem->mutex);
-    system("clear");
-    print_board();
-    if (shared_mem->winner == -1) {
+    // 게임 결과 출력 (최종 게임판은 화면 갱신 스레드가 이미 그림)
+    term_render_prompt(&render);
+    if (game->winner == -1) {
         printf("게임 결과: 무승부입니다!\n");
     }
-    else if (shared_mem->winner == player_id) {
+    else if (game->winner == player_id) {
         printf("게임 결과: 당신이 승리했습니다!\n");
     }
     else {
         printf("게임 결과: 당신이 패배했습니다.\n");
     }
-    pthread_mutex_unlock(&shared_mem->mutex);
+    term_render_destroy(&render);
+}
+
+// 한 판이 끝난 뒤 다시 둘지 물음 (입력 스레드가 scanf 로 읽으므로 같은 방식으로)
+int ask_play_again(void) {
+    char answer[16];
+    printf("다시 두시겠습니까? [y/n]: ");
+    fflush(stdout);
+    return scanf("%15s", answer) == 1 && (answer[0] == 'y' || answer[0] == 'Y');
+}
+
+int main(int argc, char* argv[]) {
+    // -w: 플레이어 대신 관전자로 접속 (몇 명이든 가능)
+    // -g 슬롯: 이 게임에 앉거나 관전 (없으면 앉기는 빈 자리 아무 곳, 관전은 게임 0)
+    int watch = 0;
+    int slot = -1;
+    int opt;
+    while ((opt = getopt(argc, argv, "wg:")) != -1) {
+        if (opt == 'w') {
+            watch = 1;
+        }
+        else if (opt == 'g' && atoi(optarg) >= 0 && atoi(optarg) < SHM_MAX_GAMES) {
+            slot = atoi(optarg);
+        }
+        else {
+            fprintf(stderr, "Usage: %s [-w] [-g game]\n", argv[0]);
+            exit(1);
+        }
+    }
+    if (watch) {
+        return spectate(slot == -1 ? 0 : slot);
+    }
+
+    int shm_id = shmget(SHM_KEY, sizeof(SharedMemory), 0666);
+
+    if (shm_id < 0) {
+        perror("shmget failed");
+        exit(1);
+    }
+
+    shared_mem = (SharedMemory*)shmat(shm_id, NULL, 0);
+
+    if (shared_mem == (void*)-1) {
+        perror("shmat failed");
+        exit(1);
+    }
+
+    // 서버가 초기화를 마친 세그먼트에서 빈 자리를 잠금 없이 차지 (자리 비트맵 CAS)
+    if (atomic_load_explicit(&shared_mem->magic, memory_order_acquire) != SHM_MAGIC) {
+        printf("서버가 아직 준비되지 않았습니다.\n");
+        shmdt(shared_mem);
+        exit(1);
+    }
+    uint64_t mask[SHM_SEAT_WORDS];
+    shm_seat_mask(slot, mask);
+    int seat = shm_claim_seat(shared_mem, mask);
+    if (seat == -1) {
+        printf("이미 최대 클라이언트 수에 도달했습니다. 관전하려면 %s -w 로 접속하세요.\n", argv[0]);
+        shmdt(shared_mem);
+        exit(1);
+    }
+
+    // 한 판이 끝나면 자리를 비우고, 다시 두겠다면 빈 자리가 생길 때까지 줄을 섬
+    //  (서버는 두 플레이어가 모두 떠난 슬롯을 -r 로 정한 게임 수만큼 다시 엶)
+    for (;;) {
+        play_game(seat);
+        shm_leave_seat(shared_mem, seat);
+        if (!ask_play_again()) {
+            break;
+        }
+        printf("상대를 기다리는 중...\n");
+        fflush(stdout);
+        seat = shm_wait_seat(shared_mem, mask);
+        if (seat == -1) {
+            printf("서버가 더 이상 게임을 열지 않습니다.\n");
+            break;
+        }
+    }
 
     // 공유 메모리 분리
     shmdt(shared_mem);
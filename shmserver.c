@@ -5,163 +5,447 @@
 #include <sys/shm.h>
 #include <unistd.h>
 #include <string.h>
+#include <errno.h>
+#include <stdint.h>
 #include <time.h>  // 시간 측정을 위한 헤더 파일 추가
-
-#define SHM_KEY 60104      // 공유 메모리 키를 60103으로 설정
-#define BOARD_SIZE 9
-#define MAX_CLIENTS 2
-
-typedef struct {
-    char board[BOARD_SIZE];
-    int turn;       // 현재 차례: 0 또는 1
-    int game_over;  // 게임 종료 여부
-    int winner;     // 승자: -1(무승부), 0 또는 1
-    int client_count;
-    int ready[MAX_CLIENTS];
-    pthread_mutex_t mutex;
-    pthread_cond_t cond;
-} SharedMemory;
-
-SharedMemory* shared_mem;
-
-void initialize_board() {
+#include "shm_common.h"
+#include "shm_broadcast.h"
+#include "term_render.h"
+#include "ttt_solved.h"
+#include "stats.h"
+#include "journal.h"
+#include "state_file.h"
+
+#define BOARD_SIZE SHM_BOARD_SIZE
+#define MAX_CLIENTS SHM_MAX_CLIENTS
+
+SharedMemory* shared_mem; // 머리 정보 + 게임 슬롯 배열 (관리 스레드들이 슬롯을 나누어 맡음)
+ShmBroadcast* broadcast;  // 관전자용 방송 링, 슬롯마다 하나 (별도 세그먼트, 관전자는 읽기 전용으로 붙음)
+int game_count = 1;       // 연 슬롯 수 (-g)
+int total_games;          // 서버가 진행할 게임 수 (-r, 기본: 슬롯마다 한 판, 0: 제한 없음)
+_Atomic int games_opened; // 지금까지 연 게임 수 (처음 연 슬롯 포함)
+_Atomic int next_game_id; // 다시 연 슬롯의 새 게임 번호 (기록 파일의 세션 번호, 처음 연 게임은 슬롯 번호)
+int game_id[SHM_MAX_GAMES]; // 슬롯에서 진행 중인 게임의 번호
+_Atomic int server_closing; // 모든 관리 스레드가 끝남 (화면 스레드 종료)
+int bot_player = -1; // 서버가 미리 푼 표로 두는 플레이어 (-1: 없음)
+StateFile state_file; // 수마다 게임 상태를 저장하는 파일 (-f, 열지 않으면 header 가 NULL), 세션 번호 = 슬롯 번호
+int last_cell[SHM_MAX_GAMES]; // 슬롯별 마지막으로 둔 칸 (상태 파일, 관전자용)
+
+// 게임 상태를 상태 파일에 저장 (게임판은 그 슬롯을 맡은 관리 스레드만 바꾸므로 잠금 없이 읽음)
+void save_state(int slot) {
+    if (state_file.header == NULL) {
+        return;
+    }
+    ShmGame* game = &shared_mem->games[slot];
+    uint32_t seats = atomic_load(&game->seats);
+    StateSnapshot snapshot;
+    snapshot.turn = game->turn;
+    snapshot.over = game->game_over;
+    snapshot.winner = !game->game_over ? -1 : game->winner == -1 ? 2 : game->winner;
+    for (int i = 0; i < MAX_CLIENTS; i++) {
+        snapshot.connected[i] = (seats >> i) & 1;
+    }
+    snapshot.last_row = last_cell[slot] == -1 ? -1 : last_cell[slot] / TTT_SIDE;
+    snapshot.last_col = last_cell[slot] == -1 ? -1 : last_cell[slot] % TTT_SIDE;
+    snapshot.moves = game->move_count;
     for (int i = 0; i < BOARD_SIZE; i++) {
-        shared_mem->board[i] = ' ';
+        snapshot.cells[i] = (signed char)ttt_cell(&game->board, i);
     }
+    state_save(&state_file, slot, &snapshot);
 }
 
-void print_board() {
-    printf("\n");
+// 상태 파일에 진행 중인 게임이 있으면 게임판, 차례, 수 개수를 되살림 (클라이언트는 다시 접속)
+int restore_state(int slot) {
+    StateSnapshot snapshot;
+    if (state_file.header == NULL || state_load(&state_file, slot, &snapshot) == -1 || snapshot.over) {
+        return 0;
+    }
+    TttBoard board;
+    ttt_init(&board);
+    int stones[MAX_CLIENTS] = { 0, 0 };
     for (int i = 0; i < BOARD_SIZE; i++) {
-        printf(" %c ", shared_mem->board[i]);
-        if ((i + 1) % 3 == 0) {
-            printf("\n");
-            if (i < 6) printf("---+---+---\n");
-        }
-        else {
-            printf("|");
+        if (snapshot.cells[i] != MNK_EMPTY) {
+            ttt_place(&board, snapshot.cells[i], i);
+            stones[(int)snapshot.cells[i]]++;
         }
     }
-    printf("\n");
+    // 차례와 수 개수가 돌과 맞고 아직 끝나지 않은 게임판만 이어 둠
+    if (stones[0] + stones[1] != snapshot.moves || snapshot.turn != stones[0] - stones[1] ||
+        TTT_STATE_RESULT(ttt_state(&board)) != TTT_STATE_PLAYING) {
+        return 0;
+    }
+    ShmGame* game = &shared_mem->games[slot];
+    game->board = board;
+    game->turn = snapshot.turn;
+    game->move_count = snapshot.moves;
+    last_cell[slot] = snapshot.last_row == -1 ? -1 : snapshot.last_row * TTT_SIDE + snapshot.last_col;
+    return 1;
 }
 
-int check_winner() {
-    int win_patterns[8][3] = {
-        {0,1,2}, {3,4,5}, {6,7,8}, // Rows
-        {0,3,6}, {1,4,7}, {2,5,8}, // Columns
-        {0,4,8}, {2,4,6}           // Diagonals
-    };
+// 현재 게임 상태를 관전자용 링에 발행 (게임판은 그 슬롯을 맡은 관리 스레드만 바꾸므로 잠금 없이 읽음, 깨우기는 따로)
+void publish_frame(int slot) {
+    ShmGame* game = &shared_mem->games[slot];
+    ShmFrame frame;
+    frame.board = game->board;
+    frame.turn = game->turn;
+    frame.game_over = game->game_over;
+    frame.winner = game->winner;
+    frame.move_count = game->move_count;
+    frame.last_cell = last_cell[slot];
+    frame.published_ns = stats_now_ns();
+    shm_broadcast_publish(&broadcast[slot], &frame);
+}
 
-    for (int i = 0; i < 8; i++) {
-        if (shared_mem->board[win_patterns[i][0]] != ' ' &&
-            shared_mem->board[win_patterns[i][0]] == shared_mem->board[win_patterns[i][1]] &&
-            shared_mem->board[win_patterns[i][1]] == shared_mem->board[win_patterns[i][2]]) {
-            return (shared_mem->board[win_patterns[i][0]] == 'X') ? 0 : 1;
-        }
+// 슬롯 하나를 새 게임으로 초기화 (서버 봇 자리는 미리 앉혀 둠)
+void initialize_game(int slot) {
+    ShmGame* game = &shared_mem->games[slot];
+    shm_seqlock_init(&game->state_lock);
+    ttt_init(&game->board);
+    game->turn = 0;
+    game->game_over = 0;
+    game->winner = -1;
+    game->move_count = 0;
+    atomic_store(&game->seats, bot_player != -1 ? 1u << bot_player : 0);
+    game->manager = slot % shared_mem->manager_count;
+    shm_event_init(&game->board_event);
+    for (int i = 0; i < MAX_CLIENTS; i++) {
+        shm_ring_init(&game->commands[i]);
+        shm_event_init(&game->player_event[i]);
+        atomic_store(&game->ack_seq[i], 0);
+        atomic_store(&game->ack_result[i], 0);
     }
-    return -1;
+    last_cell[slot] = -1;
+    game_id[slot] = slot;
 }
 
-void* game_manager_thread(void* arg) {
-    while (!shared_mem->game_over) {
-        pthread_mutex_lock(&shared_mem->mutex);
+// 수 요청 하나를 검증하여 적용 (게임판은 그 슬롯을 맡은 관리 스레드만 변경함), 0: 적용, -1: 거부
+int apply_command(int slot, int player_id, const ShmCommand* cmd) {
+    ShmGame* game = &shared_mem->games[slot];
+    if (game->game_over || game->turn != player_id) {
+        return -1; // 차례가 아닌 플레이어의 요청
+    }
+    TttBoard next = game->board;
+    if (ttt_place(&next, player_id, cmd->cell) == -1) {
+        return -1; // 잘못된 칸 또는 이미 놓인 칸
+    }
+
+    // 관찰자는 seqlock 으로 복사하므로 기록 구간만 표시 (잠금 없음)
+    shm_seqlock_write_begin(&game->state_lock);
+    game->board = next;
+    game->turn = (player_id + 1) % 2; // 턴 전환
+    game->move_count++;
+    last_cell[slot] = cmd->cell;
+    journal_move(game_id[slot], player_id, cmd->cell);
+
+    // 수를 적용한 직후 승리/무승부 확인 (3진수 인덱스로 상태 표 조회 한 번)
+    switch (TTT_STATE_RESULT(ttt_state(&game->board))) {
+    case TTT_STATE_X_WINS:
+        game->winner = 0;
+        game->game_over = 1;
+        break;
+    case TTT_STATE_O_WINS:
+        game->winner = 1;
+        game->game_over = 1;
+        break;
+    case TTT_STATE_DRAW:
+        game->winner = -1;
+        game->game_over = 1;
+        break;
+    }
+    shm_seqlock_write_end(&game->state_lock);
+    publish_frame(slot);
+    save_state(slot);
+    if (game->game_over) {
+        journal_end(game_id[slot], game->winner == -1 ? 2 : game->winner); // 공유 메모리의 -1 은 무승부
+    }
+    return 0;
+}
 
-        // 모든 클라이언트가 준비될 때까지 대기
-        while (shared_mem->client_count < MAX_CLIENTS) {
-            pthread_cond_wait(&shared_mem->cond, &shared_mem->mutex);
+// 슬롯 하나의 게임 진행 단계 (관리 스레드만 읽고 씀)
+//  LEAVING: 게임이 끝났고 더 열 게임이 남음, 두 플레이어가 자리를 비우면 새 게임으로 다시 엶
+enum { SLOT_SEATING, SLOT_PLAYING, SLOT_LEAVING, SLOT_DONE };
+int slot_phase[SHM_MAX_GAMES];
+
+// 새 게임 하나를 열 몫을 잡음 (관리 스레드 여럿이 함께 세므로 CAS), 0: 더 열 게임이 없음
+int reserve_game(void) {
+    int opened = atomic_load(&games_opened);
+    while (total_games == 0 || opened < total_games) {
+        if (atomic_compare_exchange_weak(&games_opened, &opened, opened + 1)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// 두 플레이어가 떠난 슬롯을 새 게임으로 다시 열고 빈 자리를 비트맵에 돌려놓음
+//  이벤트는 초기화하지 않고 신호만 보냄 (화면 스레드가 기다리는 seq 를 되돌리지 않음)
+void reopen_slot(int slot) {
+    ShmGame* game = &shared_mem->games[slot];
+    shm_seqlock_write_begin(&game->state_lock);
+    ttt_init(&game->board);
+    game->turn = 0;
+    game->game_over = 0;
+    game->winner = -1;
+    game->move_count = 0;
+    shm_seqlock_write_end(&game->state_lock);
+    for (int i = 0; i < MAX_CLIENTS; i++) {
+        shm_ring_init(&game->commands[i]); // 떠난 플레이어가 남긴 요청은 버림
+        atomic_store(&game->ack_seq[i], 0);
+        atomic_store(&game->ack_result[i], 0);
+    }
+    last_cell[slot] = -1;
+    game_id[slot] = atomic_fetch_add(&next_game_id, 1);
+    slot_phase[slot] = SLOT_SEATING;
+    publish_frame(slot);
+    save_state(slot);
+    shm_event_signal(&game->board_event);
+    shm_broadcast_notify(&broadcast[slot]);
+
+    // 슬롯을 모두 초기화한 뒤에 자리를 돌려놓고 줄 선 클라이언트를 깨움
+    for (int p = 0; p < MAX_CLIENTS; p++) {
+        int seat = slot * MAX_CLIENTS + p;
+        if (p != bot_player) {
+            atomic_fetch_or_explicit(&shared_mem->free_seats[seat / 64], 1ull << (seat % 64), memory_order_release);
         }
+    }
+    shm_event_signal(&shared_mem->lobby_event);
+}
 
-        // 승리 조건 확인
-        shared_mem->winner = check_winner();
-        if (shared_mem->winner != -1) {
-            shared_mem->game_over = 1;
+// 게임이 끝난 슬롯 정리 (여러 게임을 열었으면 게임판 화면 대신 끝난 게임마다 한 줄)
+//  더 열 게임이 남았으면 플레이어가 떠나기를 기다렸다가 다시 열고, 아니면 슬롯을 닫음
+void finish_slot(int slot) {
+    ShmGame* game = &shared_mem->games[slot];
+    slot_phase[slot] = reserve_game() ? SLOT_LEAVING : SLOT_DONE;
+    stats_count(STATS_GAMES_FINISHED, 1);
+    if (game_count > 1) {
+        if (game->winner == -1) {
+            printf("게임 %d: 무승부 (%d수)\n", slot, game->move_count);
         }
         else {
-            // 무승부 확인
-            int empty_spaces = 0;
-            for (int i = 0; i < BOARD_SIZE; i++) {
-                if (shared_mem->board[i] == ' ') {
-                    empty_spaces++;
-                }
-            }
-            if (empty_spaces == 0) {
-                shared_mem->game_over = 1;
-                shared_mem->winner = -1;
-            }
+            printf("게임 %d: 플레이어 %d 승리 (%d수)\n", slot, game->winner, game->move_count);
         }
+        fflush(stdout);
+    }
+}
 
-        if (shared_mem->game_over) {
-            // 게임이 종료되었으므로 모든 스레드를 깨웁니다.
-            pthread_cond_broadcast(&shared_mem->cond);
+// 슬롯 하나에 쌓인 일을 처리 (기다리지 않음), 반환: 1 이면 무언가 처리했으므로 다시 확인
+int serve_slot(int slot) {
+    ShmGame* game = &shared_mem->games[slot];
+    int progressed = 0;
+    if (slot_phase[slot] == SLOT_DONE) {
+        return 0;
+    }
+    if (slot_phase[slot] == SLOT_LEAVING) {
+        // 서버 봇 자리만 남으면 두 플레이어 모두 결과를 읽고 떠난 것
+        if (atomic_load(&game->seats) != (bot_player != -1 ? 1u << bot_player : 0)) {
+            return 0;
+        }
+        reopen_slot(slot);
+        return 1;
+    }
+    if (slot_phase[slot] == SLOT_SEATING) {
+        // 두 자리가 모두 차야 시작 (자리는 클라이언트가 비트맵에서 차지하고 doorbell 로 알림)
+        if (atomic_load(&game->seats) != SHM_SEATS_FULL) {
+            return 0;
         }
+        slot_phase[slot] = SLOT_PLAYING;
+        stats_count(STATS_GAMES_STARTED, 1);
+        save_state(slot); // 접속한 플레이어 기록
+        progressed = 1;
+    }
 
-        pthread_mutex_unlock(&shared_mem->mutex);
-        usleep(100000); // 0.1초 대기
+    // 클라이언트별 명령 링을 비우며 요청 처리 (잠금 없음)
+    unsigned notify = 0; // 깨울 플레이어 비트
+    int changed = 0;     // 게임판이 바뀌었는지
+    for (int p = 0; p < MAX_CLIENTS; p++) {
+        ShmCommand cmd;
+        while (shm_ring_pop(&game->commands[p], &cmd)) {
+            int result = apply_command(slot, p, &cmd);
+            changed |= (result == 0);
+            stats_count(result == 0 ? STATS_MOVES : STATS_INVALID_MOVES, 1);
+            atomic_store_explicit(&game->ack_result[p], result, memory_order_relaxed);
+            atomic_store_explicit(&game->ack_seq[p], cmd.seq, memory_order_release);
+            notify |= 1u << p;
+        }
+    }
+    // 서버 봇의 차례면 표 조회 한 번으로 바로 둠 (탐색 없음)
+    if (bot_player != -1 && !game->game_over && game->turn == bot_player) {
+        ShmCommand bot_cmd = { .cell = ttt_solved_move(&game->board) };
+        if (apply_command(slot, bot_player, &bot_cmd) == 0) {
+            changed = 1;
+            stats_count(STATS_MOVES, 1);
+        }
+        else {
+            fprintf(stderr, "게임 %d: 서버 봇(플레이어 %d)이 칸 %d에 둘 수 없음\n", slot, bot_player, bot_cmd.cell);
+        }
+    }
+    if (notify == 0 && !changed) {
+        return progressed;
     }
-    return NULL;
-}
 
-void* display_thread(void* arg) {
-    while (!shared_mem->game_over) {
-        pthread_mutex_lock(&shared_mem->mutex);
-        system("clear");
-        printf("틱택토 게임 서버\n");
-        print_board();
-        pthread_mutex_unlock(&shared_mem->mutex);
-        sleep(1);
-    }
-
-    // 게임 종료 시 최종 보드 상태 출력
-    pthread_mutex_lock(&shared_mem->mutex);
-    system("clear");
-    printf("게임 종료!\n");
-    print_board();
-    if (shared_mem->winner == -1) {
-        printf("무승부입니다.\n");
+    // 요청을 보낸 플레이어와 차례가 된 플레이어만 깨움 (종료 시 모두)
+    if (game->game_over) {
+        notify = (1u << MAX_CLIENTS) - 1;
     }
     else {
-        printf("플레이어 %d 승리!\n", shared_mem->winner);
+        notify |= 1u << game->turn;
+    }
+    for (int p = 0; p < MAX_CLIENTS; p++) {
+        if (notify & (1u << p)) {
+            shm_event_signal(&game->player_event[p]);
+        }
+    }
+    if (changed) {
+        shm_event_signal(&game->board_event);   // 화면 갱신 대상에게 새 세대 알림
+        shm_broadcast_notify(&broadcast[slot]); // 관전자는 플레이어를 깨운 뒤에 깨움
     }
-    pthread_mutex_unlock(&shared_mem->mutex);
+    if (game->game_over) {
+        finish_slot(slot);
+    }
+    return 1;
+}
 
+// 관리 스레드 하나: slot % manager_count 가 자기 번호인 슬롯들을 돌며 처리하고, 할 일이 없으면 doorbell 에서 잠듦
+//  슬롯끼리 공유하는 잠금은 없음, 같은 관리 스레드의 슬롯들만 doorbell 하나를 함께 씀
+void* game_manager_thread(void* arg) {
+    int manager = (int)(intptr_t)arg;
+    int manager_count = shared_mem->manager_count;
+    ShmEvent* doorbell = &shared_mem->doorbells[manager];
+    for (;;) {
+        uint32_t seen = shm_event_prepare(doorbell);
+        int progressed = 0;
+        int open = 0; // 아직 끝나지 않은 슬롯 수
+        for (int slot = manager; slot < game_count; slot += manager_count) {
+            progressed |= serve_slot(slot);
+            open += slot_phase[slot] != SLOT_DONE;
+        }
+        if (open == 0) {
+            break;
+        }
+        if (!progressed) {
+            // 맡은 슬롯에 새 자리나 요청이 생길 때까지 잠듦
+            uint64_t wait_start = stats_now_ns();
+            shm_event_wait(doorbell, seen);
+            stats_time(STATS_WAIT, stats_now_ns() - wait_start);
+        }
+    }
     return NULL;
 }
 
-void* client_handler_thread(void* arg) {
-    int player_id = *(int*)arg;
-    free(arg);
-
-    while (!shared_mem->game_over) {
-        pthread_mutex_lock(&shared_mem->mutex);
+// 게임을 하나만 열었을 때 슬롯 0 의 게임판을 그림 (슬롯을 다시 열면 다음 게임도)
+void* display_thread(void* arg) {
+    (void)arg;
+    ShmGame* game = &shared_mem->games[0];
+    for (;;) {
+        TermRender render;
+        term_render_init(&render);
+
+        // 게임판 세대가 바뀔 때만 깨어나 바뀐 칸만 다시 그림 (게임 잠금 없이)
+        for (;;) {
+            uint32_t generation = shm_event_prepare(&game->board_event);
+            ShmGameView view;
+            shm_state_snapshot(game, &view);
+            term_render_update(&render, generation, &view.board, view.game_over ? "게임 종료!" : "틱택토 게임 서버");
+            if (view.game_over) {
+                break;
+            }
+            shm_event_wait(&game->board_event, generation);
+        }
 
-        // 자신의 차례가 아닐 때 대기
-        while (shared_mem->turn != player_id && !shared_mem->game_over) {
-            pthread_cond_wait(&shared_mem->cond, &shared_mem->mutex);
+        // 게임 종료 시 결과 출력
+        term_render_prompt(&render);
+        if (game->winner == -1) {
+            printf("무승부입니다.\n");
         }
+        else {
+            printf("플레이어 %d 승리!\n", game->winner);
+        }
+        term_render_destroy(&render);
 
-        if (shared_mem->game_over) {
-            pthread_mutex_unlock(&shared_mem->mutex);
+        // 슬롯이 다시 열리거나(reopen_slot) 서버가 끝날 때까지 대기
+        for (;;) {
+            uint32_t generation = shm_event_prepare(&game->board_event);
+            if (atomic_load(&server_closing) || !game->game_over) {
+                break;
+            }
+            shm_event_wait(&game->board_event, generation);
+        }
+        if (atomic_load(&server_closing)) {
             break;
         }
-
-        // 클라이언트의 입력 대기 (실제 입력은 클라이언트에서 처리)
-        pthread_mutex_unlock(&shared_mem->mutex);
-        usleep(100000); // 0.1초 대기
     }
     return NULL;
 }
 
-int main() {
+// 세그먼트 생성: 이전 실행이 남긴 크기가 다른 세그먼트는 지우고 다시 만듦
+int create_segment(key_t key, size_t size, int mode) {
+    int id = shmget(key, size, IPC_CREAT | mode);
+    if (id < 0 && errno == EINVAL) {
+        int stale = shmget(key, 0, 0);
+        if (stale >= 0 && shmctl(stale, IPC_RMID, NULL) == 0) {
+            id = shmget(key, size, IPC_CREAT | mode);
+        }
+    }
+    return id;
+}
+
+int main(int argc, char* argv[]) {
     struct timespec start_time, end_time; // 시간 측정 변수 선언
     double elapsed_time;
 
+    // -a 0|1: 한 자리는 서버 봇이 두고 클라이언트는 한 명만 접속
+    // -j 파일: 모든 수와 결과를 이진 기록 파일에 남김 (./ttt-replay 로 다시 검증)
+    // -f 파일: 수마다 게임 상태를 저장, 서버가 죽은 뒤 다시 켜면 진행 중이던 게임을 이어 둠
+    // -g 개수: 세그먼트 하나에 게임 슬롯 여러 개를 열어 동시에 진행 (클라이언트는 빈 자리를 차지)
+    // -r 개수: 모두 합쳐 이만큼의 게임을 진행 (끝난 슬롯은 두 플레이어가 떠나면 다시 열어 다시 줄 선 클라이언트를 받음)
+    //          기본: 슬롯마다 한 판, 0: 제한 없음
+    const char* journal_path = NULL;
+    const char* state_path = NULL;
+    int opt;
+    int rounds = -1;
+    while ((opt = getopt(argc, argv, "a:j:f:g:r:")) != -1) {
+        if (opt == 'a' && (optarg[0] == '0' || optarg[0] == '1') && optarg[1] == '\0') {
+            bot_player = optarg[0] - '0';
+        }
+        else if (opt == 'j') {
+            journal_path = optarg;
+        }
+        else if (opt == 'f') {
+            state_path = optarg;
+        }
+        else if (opt == 'g' && atoi(optarg) >= 1 && atoi(optarg) <= SHM_MAX_GAMES) {
+            game_count = atoi(optarg);
+        }
+        else if (opt == 'r' && atoi(optarg) >= 0) {
+            rounds = atoi(optarg);
+        }
+        else {
+            fprintf(stderr, "Usage: %s [-a bot_player] [-j journal] [-f state_file] [-g games (1-%d)] [-r total_games]\n",
+                    argv[0], SHM_MAX_GAMES);
+            exit(EXIT_FAILURE);
+        }
+    }
+    // 처음에 모든 슬롯을 열므로 진행할 게임 수는 슬롯 수 이상
+    total_games = rounds == -1 ? game_count : rounds == 0 ? 0 : rounds < game_count ? game_count : rounds;
+    atomic_store(&games_opened, game_count);
+    atomic_store(&next_game_id, game_count);
+
     // 프로그램 시작 시간 기록
     if (clock_gettime(CLOCK_MONOTONIC, &start_time) == -1) {
         perror("clock_gettime failed");
         exit(EXIT_FAILURE);
     }
 
-    int shm_id = shmget(SHM_KEY, sizeof(SharedMemory), IPC_CREAT | 0666);
+    if (journal_path != NULL &&
+        journal_open(journal_path, "shmserver", TTT_SIDE, TTT_SIDE, TTT_SIDE, JOURNAL_CAPACITY) == -1) {
+        exit(EXIT_FAILURE);
+    }
+    if (state_path != NULL &&
+        state_open(&state_file, state_path, "shmserver", game_count, TTT_SIDE, TTT_SIDE, TTT_SIDE) == -1) {
+        exit(EXIT_FAILURE);
+    }
+
+    int shm_id = create_segment(SHM_KEY, sizeof(SharedMemory), 0666);
 
     if (shm_id < 0) {
         perror("shmget failed");
@@ -175,56 +459,111 @@ int main() {
         exit(1);
     }
 
-    // 공유 메모리 초기화
-    initialize_board();
-    shared_mem->turn = 0;
-    shared_mem->game_over = 0;
-    shared_mem->winner = -1;
-    shared_mem->client_count = 0;
-    memset(shared_mem->ready, 0, sizeof(shared_mem->ready));
-
-    // 뮤텍스와 조건 변수 초기화
-    pthread_mutexattr_t mutex_attr;
-    pthread_condattr_t cond_attr;
-
-    pthread_mutexattr_init(&mutex_attr);
-    pthread_mutexattr_setpshared(&mutex_attr, PTHREAD_PROCESS_SHARED);
+    // 관전자용 방송 세그먼트: 슬롯마다 링 하나, 수마다 프레임 한 번 기록
+    //  관전자(./shmclient -w)는 몇 명이든 읽기만 함
+    int broadcast_id = create_segment(SHM_BROADCAST_KEY, sizeof(ShmBroadcast) * (size_t)game_count, 0644);
+    if (broadcast_id < 0) {
+        perror("shmget broadcast failed");
+        exit(1);
+    }
+    broadcast = (ShmBroadcast*)shmat(broadcast_id, NULL, 0);
+    if (broadcast == (void*)-1) {
+        perror("shmat broadcast failed");
+        exit(1);
+    }
 
-    pthread_condattr_init(&cond_attr);
-    pthread_condattr_setpshared(&cond_attr, PTHREAD_PROCESS_SHARED);
+    // 공유 메모리 초기화: 슬롯을 모두 준비한 뒤 빈 자리 비트맵을 채우고 magic 을 마지막에 기록
+    //  (클라이언트는 magic 을 확인한 뒤에만 자리를 차지함)
+    atomic_store(&shared_mem->magic, 0);
+    shared_mem->game_count = game_count;
+    // 관리 스레드는 CPU 마다 하나 (슬롯보다 많을 필요는 없음), 슬롯은 번호 순으로 돌아가며 나눔
+    //  클라이언트는 낮은 번호의 빈 자리부터 채우므로 앞쪽 슬롯들이 여러 관리 스레드에 고르게 퍼짐
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    int manager_count = cpus < 1 ? 1 : cpus < game_count ? (int)cpus : game_count;
+    shared_mem->manager_count = manager_count;
+    for (int m = 0; m < manager_count; m++) {
+        shm_event_init(&shared_mem->doorbells[m]);
+    }
+    shm_event_init(&shared_mem->lobby_event);
+    int resumed = 0;
+    uint64_t free_seats[SHM_SEAT_WORDS] = { 0 };
+    for (int slot = 0; slot < game_count; slot++) {
+        initialize_game(slot);
+        resumed += restore_state(slot);
+        publish_frame(slot); // 관전자가 첫 수 전에 붙어도 게임판을 볼 수 있도록
+        for (int p = 0; p < MAX_CLIENTS; p++) {
+            int seat = slot * MAX_CLIENTS + p;
+            if (p != bot_player) {
+                free_seats[seat / 64] |= 1ull << (seat % 64); // 봇 자리는 이미 찬 자리
+            }
+        }
+    }
+    for (int w = 0; w < SHM_SEAT_WORDS; w++) {
+        atomic_store(&shared_mem->free_seats[w], free_seats[w]);
+    }
+    atomic_store_explicit(&shared_mem->magic, SHM_MAGIC, memory_order_release);
 
-    pthread_mutex_init(&shared_mem->mutex, &mutex_attr);
-    pthread_cond_init(&shared_mem->cond, &cond_attr);
+    // 통계 세그먼트: 실행 중에 ./ttt-stats 로 확인
+    stats_open(STATS_NAME_SHM, "shmserver");
 
     printf("틱택토 서버가 시작되었습니다...\n");
+    if (game_count > 1) {
+        printf("게임 %d개를 동시에 진행합니다 (슬롯 0~%d).\n", game_count, game_count - 1);
+    }
+    if (bot_player != -1) {
+        printf("플레이어 %d은 서버 봇이 둡니다.\n", bot_player);
+    }
+    if (total_games != game_count) {
+        if (total_games == 0) {
+            printf("끝난 게임의 플레이어는 다시 줄을 서서 새 게임을 할 수 있습니다.\n");
+        }
+        else {
+            printf("끝난 게임의 플레이어는 다시 줄을 서서 새 게임을 할 수 있습니다 (모두 %d판).\n", total_games);
+        }
+    }
+    if (resumed == 1 && game_count == 1) {
+        printf("상태 파일에서 이전 게임을 이어 둡니다 (%d수, 플레이어 %d의 차례).\n", shared_mem->games[0].move_count,
+               shared_mem->games[0].turn);
+    }
+    else if (resumed > 0) {
+        printf("상태 파일에서 진행 중이던 게임 %d개를 이어 둡니다.\n", resumed);
+    }
+    fflush(stdout);
 
-    // 스레드 생성
-    pthread_t game_thread, display_t;
-    pthread_create(&game_thread, NULL, game_manager_thread, NULL);
-    pthread_create(&display_t, NULL, display_thread, NULL);
-
-    // 클라이언트 핸들러 스레드 생성
-    pthread_t client_threads[MAX_CLIENTS];
-    for (int i = 0; i < MAX_CLIENTS; i++) {
-        int* arg = malloc(sizeof(*arg));
-        *arg = i;
-        pthread_create(&client_threads[i], NULL, client_handler_thread, arg);
+    // 스레드 생성: 관리 스레드 manager_count 개 (슬롯 수와 무관), 게임판 화면은 게임이 하나일 때만
+    pthread_t game_threads[SHM_MAX_GAMES], display_t;
+    for (int m = 0; m < manager_count; m++) {
+        pthread_create(&game_threads[m], NULL, game_manager_thread, (void*)(intptr_t)m);
+    }
+    if (game_count == 1) {
+        pthread_create(&display_t, NULL, display_thread, NULL);
     }
 
     // 스레드 종료 대기
-    pthread_join(game_thread, NULL);
-    pthread_join(display_t, NULL);
-    for (int i = 0; i < MAX_CLIENTS; i++) {
-        pthread_join(client_threads[i], NULL);
+    for (int m = 0; m < manager_count; m++) {
+        pthread_join(game_threads[m], NULL);
+    }
+    // 더 열 게임이 없음: 다시 줄 선 클라이언트와 화면 스레드를 깨워 끝냄
+    atomic_store(&server_closing, 1);
+    atomic_store_explicit(&shared_mem->magic, 0, memory_order_release);
+    shm_event_signal(&shared_mem->lobby_event);
+    shm_event_signal(&shared_mem->games[0].board_event);
+    if (game_count == 1) {
+        pthread_join(display_t, NULL);
     }
-
-    // 뮤텍스와 조건 변수 파괴
-    pthread_mutex_destroy(&shared_mem->mutex);
-    pthread_cond_destroy(&shared_mem->cond);
 
     // 공유 메모리 분리 및 삭제
     shmdt(shared_mem);
     shmctl(shm_id, IPC_RMID, NULL);
+    shmdt(broadcast); // 붙어 있는 관전자는 마지막 프레임(게임 종료)까지 읽을 수 있음
+    shmctl(broadcast_id, IPC_RMID, NULL);
+    journal_close();
+    stats_close();
+    if (state_path != NULL) {
+        // 게임이 끝났으므로 이어 둘 것이 없음
+        state_close(&state_file);
+        unlink(state_path);
+    }
 
 
     // 프로그램 종료 시간 기록
@@ -0,0 +1,92 @@
+// sock_server.c
+// AF_UNIX 소켓 서버: 클라이언트는 ./client -u [소켓 경로] 로 순서와 관계없이 접속
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <signal.h>
+#include "sock_session.h"
+#include "stats.h"
+#include "journal.h"
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s [-p socket_path] [-g games] [-b ROWSxCOLS] [-k k] [-q] [-j journal]\n", prog);
+    fprintf(stderr, "  예) %s -g 100 -q   (100판이 끝나면 통계를 출력하고 종료)\n", prog);
+    fprintf(stderr, "  -j: 모든 수와 결과를 이진 기록 파일에 남김 (./ttt-replay 로 다시 검증)\n");
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char *argv[])
+{
+    // 서버 설정 (기본: ./ttt.sock, 3x3 3목, 무제한)
+    SockConfig config;
+    sock_config_default(&config);
+    const char *journal_path = NULL;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "p:g:b:k:qj:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'p':
+            config.path = optarg;
+            break;
+        case 'g':
+            config.max_games = atol(optarg);
+            break;
+        case 'b':
+            if (sscanf(optarg, "%dx%d", &config.rows, &config.cols) != 2)
+                usage(argv[0]);
+            break;
+        case 'k':
+            config.k = atoi(optarg);
+            break;
+        case 'q':
+            config.verbose = 0;
+            break;
+        case 'j':
+            journal_path = optarg;
+            break;
+        default:
+            usage(argv[0]);
+        }
+    }
+    if (config.max_games < 0 || optind != argc)
+    {
+        usage(argv[0]);
+    }
+
+    // 끊긴 클라이언트에 보내다가 종료되지 않도록 (실패는 wire_send 반환값으로 처리)
+    signal(SIGPIPE, SIG_IGN);
+
+    SockServer server;
+    if (sock_server_init(&server, &config) == -1)
+    {
+        sock_server_destroy(&server);
+        exit(EXIT_FAILURE);
+    }
+
+    // 통계 세그먼트: 실행 중에 ./ttt-stats 로 확인
+    stats_open(STATS_NAME_SOCK, "sock_server");
+    if (journal_path != NULL &&
+        journal_open(journal_path, "sock_server", config.rows, config.cols, config.k, JOURNAL_CAPACITY) == -1)
+    {
+        sock_server_destroy(&server);
+        stats_close();
+        exit(EXIT_FAILURE);
+    }
+
+    printf("**서버> %s 에서 접속 대기 중 (%dx%d, %d목)...**\n", config.path, config.rows, config.cols, config.k);
+    fflush(stdout);
+
+    int rc = sock_server_run(&server);
+    sock_server_print_stats(&server);
+    sock_server_destroy(&server);
+    journal_close();
+    stats_close();
+
+    printf("**서버 종료**.\n");
+    fflush(stdout);
+
+    return rc == 0 ? 0 : EXIT_FAILURE;
+}
@@ -0,0 +1,441 @@
+// sock_session.c
+#define _GNU_SOURCE // accept4
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/epoll.h>
+#include "sock_session.h"
+#include "stats.h"
+#include "journal.h"
+
+// 게임 로그 출력 (verbose 서버만 출력)
+#define GAME_LOG(server, g, ...)           \
+    do                                     \
+    {                                      \
+        if ((server)->config.verbose)      \
+        {                                  \
+            printf("[게임 %d] ", (g)->id);  \
+            printf(__VA_ARGS__);           \
+            fflush(stdout);                \
+        }                                  \
+    } while (0)
+
+// 메시지 전송 (소켓은 논블로킹: 상대가 읽지 않아 송신 버퍼가 가득 차면 실패)
+//  실패하면 shutdown 으로 끊어 두고, 다음 epoll 이벤트에서 일반 접속 종료 경로로 정리
+static int conn_send(SockConn *conn, WireMessage *msg)
+{
+    if (conn == NULL || conn->fd == -1)
+        return -1;
+    msg->player = conn->player;
+    msg->timestamp_ns = wire_now_ns();
+    uint64_t start = stats_now_ns();
+    int rc = wire_send(conn->fd, msg);
+    stats_time(STATS_WRITE, stats_now_ns() - start);
+    if (rc == -1)
+    {
+        shutdown(conn->fd, SHUT_RDWR);
+        return -1;
+    }
+    return 0;
+}
+
+static void send_turn(SockGame *g)
+{
+    const GameState *game = &g->game;
+    WireMessage msg = {.type = WIRE_YOUR_TURN, .session = g->id, .turn = game->turn,
+                       .row = game->last_row, .col = game->last_col,
+                       .rows = game->board.rows, .cols = game->board.cols};
+    memcpy(msg.cells, game->board.cells, (size_t)game->board.rows * game->board.cols);
+    conn_send(g->players[game->turn], &msg);
+}
+
+// 접속을 대기열 또는 게임이 끝난 접속 목록에 넣음 (이미 다른 목록에 있으면 옮김)
+static void conn_enqueue(SockConn *conn, Lobby *queue)
+{
+    if (conn->queue != NULL)
+        lobby_remove(conn->queue, &conn->lobby);
+    conn->queue = queue;
+    if (queue != NULL)
+        lobby_push(queue, &conn->lobby, wire_now_ns());
+}
+
+// 접속 닫기: fd 는 바로 닫고 (epoll 에서도 빠짐) 구조체는 이벤트 묶음 처리가 끝난 뒤 해제
+static void conn_close(SockServer *server, SockConn *conn)
+{
+    if (conn->fd == -1)
+        return;
+    conn_enqueue(conn, NULL);
+    close(conn->fd);
+    conn->fd = -1;
+    conn->next_closed = server->closed;
+    server->closed = conn;
+}
+
+static void game_unlink(SockServer *server, SockGame *g)
+{
+    if (g->prev)
+        g->prev->next = g->next;
+    else
+        server->games = g->next;
+    if (g->next)
+        g->next->prev = g->prev;
+}
+
+// 게임 종료: 두 플레이어에게 결과를 보내고, 다시 대기열에 들어올지(WIRE_REQUEUE) 접속을 끊을지 기다림
+static void finish_game(SockServer *server, SockGame *g)
+{
+    WireMessage msg = {.type = WIRE_GAME_OVER, .session = g->id, .winner = g->game.winner};
+    journal_end(g->id, g->game.winner);
+    for (int i = 0; i < MAX_CLIENTS; i++)
+    {
+        SockConn *conn = g->players[i];
+        conn_send(conn, &msg);
+        conn->game = NULL;
+        if (conn->fd != -1)
+            conn_enqueue(conn, &server->idle);
+    }
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    char result[64];
+    describe_result(&g->game, result, sizeof(result));
+    GAME_LOG(server, g, "종료: %s, %d수, %.3f seconds\n", result, g->moves,
+             (end.tv_sec - g->start_time.tv_sec) + (end.tv_nsec - g->start_time.tv_nsec) / 1e9);
+    server->games_finished++;
+    stats_count(STATS_GAMES_FINISHED, 1);
+    game_unlink(server, g);
+    free(g);
+}
+
+static void lobby_join(SockServer *server, SockConn *conn);
+
+// 수 처리 (차례가 아니거나 잘못된 칸이면 INVALID 후 같은 플레이어에게 차례를 다시 줌)
+static void handle_move(SockServer *server, SockConn *conn, const WireMessage *msg)
+{
+    SockGame *g = conn->game;
+    WireMessage invalid = {.type = WIRE_INVALID_MOVE};
+    if (msg->type == WIRE_REQUEUE && g == NULL)
+    {
+        lobby_join(server, conn); // 이미 대기열에 있으면 맨 뒤로
+        return;
+    }
+    if (g == NULL || g->game.turn != conn->player)
+    {
+        stats_count(STATS_INVALID_MOVES, 1);
+        conn_send(conn, &invalid);
+        return;
+    }
+    invalid.session = g->id;
+
+    GameState *game = &g->game;
+    if (msg->type != WIRE_MOVE || make_move(game, conn->player, msg->row, msg->col) == -1)
+    {
+        stats_count(STATS_INVALID_MOVES, 1);
+        conn_send(conn, &invalid);
+        send_turn(g);
+        return;
+    }
+    g->moves++;
+    stats_count(STATS_MOVES, 1);
+    journal_move(g->id, conn->player, msg->row * game->board.cols + msg->col);
+
+    game->winner = check_result(game);
+    if (game->winner != -1)
+    {
+        finish_game(server, g);
+        return;
+    }
+    game->turn = 1 - game->turn;
+    send_turn(g);
+}
+
+// 수신 가능한 접속 처리: 한 번 읽고 완성된 프레임을 모두 처리
+static void conn_readable(SockServer *server, SockConn *conn)
+{
+    uint64_t start = stats_now_ns();
+    ssize_t n = wire_reader_fill(&conn->reader, conn->fd);
+    stats_time(STATS_READ, stats_now_ns() - start);
+    if (n == -1 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        return;
+    if (n <= 0)
+    {
+        // 접속 끊김: 게임 중이면 상대도 대기에서 풀려나도록 게임 종료 처리 (대기열에 있으면 빠지기만 함)
+        SockGame *g = conn->game;
+        conn_close(server, conn);
+        if (g != NULL)
+        {
+            GAME_LOG(server, g, "플레이어 %d 접속 종료\n", conn->player);
+            finish_game(server, g);
+        }
+        return;
+    }
+
+    WireMessage msg;
+    int rc;
+    while (conn->fd != -1 && (rc = wire_reader_next(&conn->reader, &msg)) != 0)
+    {
+        if (rc == WIRE_CORRUPT)
+        {
+            // 손상된 프레임: 버퍼를 비우고 다시 입력 요청
+            fprintf(stderr, "Invalid input format from connection %d.\n", conn->fd);
+            wire_reader_init(&conn->reader);
+            msg.type = 0;
+        }
+        handle_move(server, conn, &msg);
+    }
+}
+
+// 대기열 앞의 두 접속으로 새 게임 시작 (플레이어 0: 먼저 기다린 쪽)
+static int start_game(SockServer *server, SockConn *first, SockConn *second)
+{
+    SockGame *g = calloc(1, sizeof(SockGame));
+    if (g == NULL)
+        return -1;
+    g->id = server->next_game_id++ % WIRE_LOBBY_SESSION;
+    init_game(&g->game, server->config.rows, server->config.cols, server->config.k); // 설정은 init 에서 검사함
+    g->next = server->games;
+    if (server->games)
+        server->games->prev = g;
+    server->games = g;
+
+    uint64_t now = wire_now_ns();
+    SockConn *players[MAX_CLIENTS] = {first, second};
+    for (int i = 0; i < MAX_CLIENTS; i++)
+    {
+        SockConn *conn = players[i];
+        uint64_t waited = now - conn->lobby.queued_ns;
+        server->match_wait_ns += waited;
+        if (waited > server->match_wait_max_ns)
+            server->match_wait_max_ns = waited;
+        conn->queue = NULL;
+        conn->player = i;
+        conn->game = g;
+        g->players[i] = conn;
+        WireMessage welcome = {.type = WIRE_WELCOME, .session = g->id};
+        conn_send(conn, &welcome);
+    }
+    server->games_started++;
+    stats_count(STATS_GAMES_STARTED, 1);
+    clock_gettime(CLOCK_MONOTONIC, &g->start_time);
+    GAME_LOG(server, g, "게임 시작\n");
+    send_turn(g); // 선공: 플레이어 0
+    return 0;
+}
+
+// 대기열에 넣고 두 명 이상 기다리고 있으면 바로 짝지음 (넣기, 짝짓기 모두 O(1))
+static void lobby_join(SockServer *server, SockConn *conn)
+{
+    conn->game = NULL;
+    conn_enqueue(conn, &server->lobby);
+    WireMessage waiting = {.type = WIRE_WELCOME, .session = WIRE_LOBBY_SESSION};
+    conn_send(conn, &waiting);
+
+    LobbyEntry *first, *second;
+    while (lobby_pair(&server->lobby, &first, &second))
+    {
+        SockConn *a = LOBBY_OWNER(first, SockConn, lobby);
+        SockConn *b = LOBBY_OWNER(second, SockConn, lobby);
+        if (start_game(server, a, b) == -1)
+        {
+            perror("Failed to create game");
+            conn_close(server, a);
+            conn_close(server, b);
+        }
+    }
+}
+
+// 대기열의 접속을 모두 수락 (EAGAIN 까지)
+static void accept_all(SockServer *server)
+{
+    server->accept_batches++;
+    for (;;)
+    {
+        int fd = accept4(server->listen_fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd == -1)
+        {
+            if (errno == EINTR || errno == ECONNABORTED)
+                continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+                perror("accept failed");
+            return;
+        }
+        uint64_t now = wire_now_ns();
+        if (server->accepted++ == 0)
+            server->first_accept_ns = now;
+        server->last_accept_ns = now;
+
+        SockConn *conn = calloc(1, sizeof(SockConn));
+        if (conn == NULL)
+        {
+            close(fd);
+            continue;
+        }
+        conn->fd = fd;
+        wire_reader_init(&conn->reader);
+        struct epoll_event ev = {.events = EPOLLIN, .data.ptr = conn};
+        if (epoll_ctl(server->epoll_fd, EPOLL_CTL_ADD, fd, &ev) == -1)
+        {
+            perror("connection setup failed");
+            close(fd);
+            free(conn);
+            continue;
+        }
+        lobby_join(server, conn);
+    }
+}
+
+// 이벤트 묶음 처리 후 닫힌 접속 해제
+static void free_closed(SockServer *server)
+{
+    while (server->closed != NULL)
+    {
+        SockConn *conn = server->closed;
+        server->closed = conn->next_closed;
+        free(conn);
+    }
+}
+
+// 기본 설정: ./ttt.sock, 3x3 3목, 무제한
+void sock_config_default(SockConfig *config)
+{
+    memset(config, 0, sizeof(*config));
+    config->path = SOCK_DEFAULT_PATH;
+    config->rows = TTT_SIDE;
+    config->cols = TTT_SIDE;
+    config->k = TTT_SIDE;
+    config->verbose = 1;
+}
+
+int sock_server_init(SockServer *server, const SockConfig *config)
+{
+    memset(server, 0, sizeof(*server));
+    server->config = *config;
+    server->epoll_fd = -1;
+    lobby_init(&server->lobby);
+    lobby_init(&server->idle);
+
+    GameState probe;
+    if (init_game(&probe, config->rows, config->cols, config->k) == -1)
+    {
+        fprintf(stderr, "Invalid board %dx%d, k=%d\n", config->rows, config->cols, config->k);
+        server->listen_fd = -1;
+        return -1;
+    }
+
+    struct sockaddr_un addr = {.sun_family = AF_UNIX};
+    if (strlen(config->path) >= sizeof(addr.sun_path))
+    {
+        fprintf(stderr, "Socket path too long: %s\n", config->path);
+        server->listen_fd = -1;
+        return -1;
+    }
+    strcpy(addr.sun_path, config->path);
+
+    server->listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (server->listen_fd == -1)
+    {
+        perror("socket failed");
+        return -1;
+    }
+    unlink(config->path); // 이전 실행이 남긴 소켓 파일 제거
+    if (bind(server->listen_fd, (struct sockaddr *)&addr, sizeof(addr)) == -1)
+    {
+        perror("bind failed");
+        return -1;
+    }
+    if (listen(server->listen_fd, SOCK_BACKLOG) == -1)
+    {
+        perror("listen failed");
+        return -1;
+    }
+
+    server->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    struct epoll_event ev = {.events = EPOLLIN, .data.ptr = NULL}; // ptr NULL: 수신 대기 소켓
+    if (server->epoll_fd == -1 || epoll_ctl(server->epoll_fd, EPOLL_CTL_ADD, server->listen_fd, &ev) == -1)
+    {
+        perror("epoll setup failed");
+        return -1;
+    }
+    return 0;
+}
+
+int sock_server_run(SockServer *server)
+{
+    struct epoll_event events[SOCK_EVENT_BATCH];
+    while (server->config.max_games == 0 || server->games_finished < server->config.max_games)
+    {
+        int n = epoll_wait(server->epoll_fd, events, SOCK_EVENT_BATCH, -1);
+        if (n == -1)
+        {
+            if (errno == EINTR)
+                continue;
+            perror("epoll_wait failed");
+            return -1;
+        }
+        for (int i = 0; i < n; i++)
+        {
+            SockConn *conn = events[i].data.ptr;
+            if (conn == NULL)
+                accept_all(server);
+            else if (conn->fd != -1) // 같은 묶음에서 먼저 닫힌 접속은 건너뜀
+                conn_readable(server, conn);
+        }
+        free_closed(server);
+    }
+    return 0;
+}
+
+void sock_server_destroy(SockServer *server)
+{
+    while (server->games != NULL)
+    {
+        SockGame *g = server->games;
+        for (int i = 0; i < MAX_CLIENTS; i++)
+        {
+            if (g->players[i] != NULL)
+                conn_close(server, g->players[i]);
+        }
+        game_unlink(server, g);
+        free(g);
+    }
+    Lobby *queues[] = {&server->lobby, &server->idle};
+    for (int q = 0; q < 2; q++)
+    {
+        LobbyEntry *entry;
+        while ((entry = lobby_pop(queues[q])) != NULL)
+        {
+            SockConn *conn = LOBBY_OWNER(entry, SockConn, lobby);
+            conn->queue = NULL;
+            conn_close(server, conn);
+        }
+    }
+    free_closed(server);
+    if (server->epoll_fd != -1)
+        close(server->epoll_fd);
+    if (server->listen_fd != -1)
+    {
+        close(server->listen_fd);
+        unlink(server->config.path);
+    }
+}
+
+void sock_server_print_stats(const SockServer *server)
+{
+    double span = (double)(server->last_accept_ns - server->first_accept_ns) / 1e9;
+    printf("**접속 %ld개 (수락 이벤트 %ld번, 이벤트당 %.1f개), 게임 %ld판 시작 / %ld판 종료**\n",
+           server->accepted, server->accept_batches,
+           server->accept_batches ? (double)server->accepted / server->accept_batches : 0.0,
+           server->games_started, server->games_finished);
+    if (server->accepted > 1 && span > 0)
+        printf("**수락 속도: %.0f accepts/sec (첫 접속부터 마지막 접속까지 %.3f seconds)**\n",
+               (server->accepted - 1) / span, span);
+    if (server->games_started > 0)
+        printf("**매칭 대기: 평균 %.1f us, 최대 %.1f us (대기열에 %ld명 남음)**\n",
+               server->match_wait_ns / 1e3 / (2.0 * server->games_started), server->match_wait_max_ns / 1e3,
+               server->lobby.count);
+    fflush(stdout);
+}
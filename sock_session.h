@@ -0,0 +1,73 @@
+// sock_session.h
+// AF_UNIX 소켓 서버: 하나의 epoll 루프가 접속 수락과 모든 클라이언트의 메시지를 처리
+//  접속하면 대기열(lobby)에 들어가고, 두 명이 모이는 즉시 새 게임으로 짝지어 WIRE_WELCOME 으로
+//  세션/플레이어 ID를 알려줌 (FIFO 서버처럼 미리 만든 FIFO 를 정해진 순서로 열 필요가 없음)
+//  게임이 끝난 플레이어는 WIRE_REQUEUE 를 보내 다시 대기열로 갈 수 있음
+#ifndef SOCK_SESSION_H
+#define SOCK_SESSION_H
+
+#include <stdint.h>
+#include <time.h>
+#include "pipe_session.h"
+#include "lobby.h"
+#include "wire.h"
+
+#define SOCK_DEFAULT_PATH "./ttt.sock"
+#define SOCK_BACKLOG 4096    // listen 대기열 (동시에 몰리는 접속 수용)
+#define SOCK_EVENT_BATCH 64  // epoll_wait 한 번에 받는 이벤트 수
+
+struct SockGame;
+
+typedef struct SockConn // 접속 하나
+{
+    int fd;                  // -1: 닫힘 (이번 이벤트 묶음이 끝나면 해제)
+    int player;              // 게임 안의 플레이어 ID (0 또는 1)
+    struct SockGame *game;   // NULL: 대기열에 있거나 게임이 끝나 다음 요청을 기다리는 중
+    LobbyEntry lobby;        // 대기열 또는 게임이 끝난 접속 목록의 항목
+    Lobby *queue;            // lobby 항목이 들어 있는 목록 (NULL: 게임 중)
+    WireReader reader;
+    struct SockConn *next_closed; // 해제 대기 목록
+} SockConn;
+
+typedef struct SockGame // 두 접속이 함께 두는 한 판
+{
+    int id;
+    GameState game;
+    SockConn *players[MAX_CLIENTS];
+    int moves;
+    struct timespec start_time;
+    struct SockGame *prev, *next; // 진행 중인 게임 목록
+} SockGame;
+
+typedef struct // 서버 설정
+{
+    const char *path;  // 소켓 경로
+    int rows, cols, k; // 게임판 크기와 승리 조건
+    long max_games;    // 끝난 게임이 이만큼이면 루프 종료 (0: 무제한)
+    int verbose;       // 게임별 로그 출력 여부
+} SockConfig;
+
+typedef struct // 서버 상태와 통계
+{
+    SockConfig config;
+    int listen_fd;
+    int epoll_fd;
+    SockGame *games;        // 진행 중인 게임 목록
+    Lobby lobby;            // 상대를 기다리는 접속 (도착 순서)
+    Lobby idle;             // 게임이 끝나고 다시 대기열에 들어올지 정하지 않은 접속
+    SockConn *closed;       // 해제 대기 중인 접속
+    int next_game_id;
+    long accepted;          // 수락한 접속 수
+    long accept_batches;    // 접속 수락 이벤트 수 (한 번에 여러 접속을 수락)
+    long games_started, games_finished;
+    uint64_t match_wait_ns, match_wait_max_ns; // 대기열에 들어와서 짝지어질 때까지 걸린 시간 (합계, 최대)
+    uint64_t first_accept_ns, last_accept_ns;
+} SockServer;
+
+void sock_config_default(SockConfig *config);
+int sock_server_init(SockServer *server, const SockConfig *config);
+int sock_server_run(SockServer *server); // max_games 만큼 게임이 끝나면 0 반환, 오류 시 -1
+void sock_server_destroy(SockServer *server);
+void sock_server_print_stats(const SockServer *server);
+
+#endif
@@ -0,0 +1,185 @@
+// state_file.c
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "state_file.h"
+
+static StateSlot *slot_at(const StateFile *file, int session, int copy)
+{
+    return (StateSlot *)((char *)file->header + STATE_HEADER_SIZE +
+                         ((size_t)session * 2 + (size_t)copy) * file->header->slot_size);
+}
+
+// seq 부터 복사본 끝까지의 FNV-1a (체크섬 필드 자신은 제외)
+static uint32_t slot_checksum(const StateSlot *slot, uint32_t slot_size)
+{
+    const unsigned char *p = (const unsigned char *)slot + offsetof(StateSlot, seq);
+    const unsigned char *end = (const unsigned char *)slot + slot_size;
+    uint32_t hash = 2166136261u;
+    while (p < end)
+        hash = (hash ^ *p++) * 16777619u;
+    return hash;
+}
+
+static int slot_valid(const StateFile *file, const StateSlot *slot)
+{
+    const StateHeader *h = file->header;
+    if (slot->seq == 0 || slot->checksum != slot_checksum(slot, h->slot_size))
+        return 0;
+    if ((slot->turn != 0 && slot->turn != 1) || slot->winner < -1 || slot->winner > 2 ||
+        (slot->over != 0 && slot->over != 1) || (slot->winner != -1 && !slot->over) ||
+        slot->moves < 0 || slot->moves > file->cells || slot->last_row < -1 || slot->last_row >= (int)h->rows ||
+        slot->last_col < -1 || slot->last_col >= (int)h->cols)
+        return 0;
+    for (int i = 0; i < file->cells; i++)
+        if (slot->cells[i] < MNK_EMPTY || slot->cells[i] > 1)
+            return 0;
+    return 1;
+}
+
+int state_open(StateFile *file, const char *path, const char *server, int sessions, int rows, int cols, int k)
+{
+    memset(file, 0, sizeof(*file));
+    file->cells = rows * cols;
+    uint32_t slot_size = (uint32_t)((offsetof(StateSlot, cells) + (size_t)file->cells + 15) & ~(size_t)15);
+    size_t size = STATE_HEADER_SIZE + (size_t)sessions * 2 * slot_size;
+
+    int fd = open(path, O_CREAT | O_RDWR | O_CLOEXEC, 0644);
+    if (fd == -1)
+    {
+        perror("open state file failed");
+        return -1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) == -1)
+    {
+        perror("fstat state file failed");
+        close(fd);
+        return -1;
+    }
+    int existing = st.st_size >= STATE_HEADER_SIZE;
+    if (existing && (size_t)st.st_size != size)
+    {
+        fprintf(stderr, "%s: state file was written for a different configuration\n", path);
+        close(fd);
+        return -1;
+    }
+    if (!existing)
+    {
+        int rc = posix_fallocate(fd, 0, (off_t)size);
+        if (rc != 0)
+        {
+            fprintf(stderr, "posix_fallocate state file failed: %s\n", strerror(rc));
+            close(fd);
+            return -1;
+        }
+    }
+    StateHeader *h = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, 0);
+    close(fd);
+    if (h == MAP_FAILED)
+    {
+        perror("mmap state file failed");
+        return -1;
+    }
+
+    if (existing)
+    {
+        if (h->magic != STATE_MAGIC || h->version != STATE_VERSION || h->rows != (uint32_t)rows ||
+            h->cols != (uint32_t)cols || h->k != (uint32_t)k || h->sessions != (uint32_t)sessions ||
+            h->slot_size != slot_size)
+        {
+            fprintf(stderr, "%s: state file was written for a different configuration\n", path);
+            munmap(h, size);
+            return -1;
+        }
+    }
+    else
+    {
+        // 머리 정보는 마지막에 magic 을 써서 완성된 파일만 이어 두게 함
+        h->version = STATE_VERSION;
+        h->rows = (uint32_t)rows;
+        h->cols = (uint32_t)cols;
+        h->k = (uint32_t)k;
+        h->sessions = (uint32_t)sessions;
+        h->slot_size = slot_size;
+        snprintf(h->server, sizeof(h->server), "%s", server);
+        h->magic = STATE_MAGIC;
+        msync(h, STATE_HEADER_SIZE, MS_SYNC);
+    }
+
+    // 공유 매핑은 첫 쓰기에 다시 폴트가 나므로 페이지마다 한 번씩 써 둠 (저장할 때 커널에 들어가지 않도록)
+    long page = sysconf(_SC_PAGESIZE);
+    for (size_t offset = 0; offset < size; offset += (size_t)page)
+    {
+        volatile char *p = (volatile char *)h + offset;
+        *p = *p;
+    }
+
+    file->seq = calloc((size_t)sessions, sizeof(uint32_t));
+    if (file->seq == NULL)
+    {
+        perror("calloc state seq failed");
+        munmap(h, size);
+        return -1;
+    }
+    file->header = h;
+    file->size = size;
+    return existing;
+}
+
+void state_close(StateFile *file)
+{
+    if (file->header == NULL)
+        return;
+    msync(file->header, file->size, MS_SYNC);
+    munmap(file->header, file->size);
+    free(file->seq);
+    file->header = NULL;
+    file->seq = NULL;
+}
+
+int state_load(StateFile *file, int session, StateSnapshot *snapshot)
+{
+    StateSlot *a = slot_at(file, session, 0), *b = slot_at(file, session, 1);
+    int a_ok = slot_valid(file, a), b_ok = slot_valid(file, b);
+    const StateSlot *slot = NULL;
+    if (a_ok && (!b_ok || a->seq > b->seq))
+        slot = a;
+    else if (b_ok)
+        slot = b;
+    if (slot == NULL)
+        return -1;
+
+    file->seq[session] = slot->seq;
+    snapshot->turn = slot->turn;
+    snapshot->winner = slot->winner;
+    snapshot->over = slot->over;
+    snapshot->connected[0] = slot->connected[0];
+    snapshot->connected[1] = slot->connected[1];
+    snapshot->last_row = slot->last_row;
+    snapshot->last_col = slot->last_col;
+    snapshot->moves = slot->moves;
+    memcpy(snapshot->cells, slot->cells, (size_t)file->cells);
+    return 0;
+}
+
+void state_save(StateFile *file, int session, const StateSnapshot *snapshot)
+{
+    uint32_t seq = ++file->seq[session];
+    StateSlot *slot = slot_at(file, session, (int)(seq & 1)); // 최신 복사본은 건드리지 않음
+    slot->seq = seq;
+    slot->turn = (int8_t)snapshot->turn;
+    slot->winner = (int8_t)snapshot->winner;
+    slot->over = (int8_t)snapshot->over;
+    slot->connected[0] = (int8_t)snapshot->connected[0];
+    slot->connected[1] = (int8_t)snapshot->connected[1];
+    slot->last_row = (int16_t)snapshot->last_row;
+    slot->last_col = (int16_t)snapshot->last_col;
+    slot->moves = snapshot->moves;
+    memcpy(slot->cells, snapshot->cells, (size_t)file->cells);
+    slot->checksum = slot_checksum(slot, file->header->slot_size);
+}
@@ -0,0 +1,67 @@
+// state_file.h
+// 재시작 후 이어 두기 위한 서버 상태 파일: 세션마다 게임판, 차례, 접속한 플레이어를 mmap 한 파일에 보관
+//  서버가 죽어도 MAP_SHARED 페이지는 파일에 남으므로 다시 켜면 기록을 재생하지 않고 바로 불러옴
+//  세션마다 복사본 두 개를 번갈아 씀: 새 상태는 오래된 쪽에 쓰고 seq 와 체크섬을 마지막에 기록
+//  쓰는 도중에 죽어 체크섬이 맞지 않는 복사본은 버리고 다른 쪽(직전 상태)을 사용
+//  저장은 같은 세션끼리 호출하는 쪽이 직렬화 (서로 다른 세션은 동시에 저장 가능)
+#ifndef STATE_FILE_H
+#define STATE_FILE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "mnk_board.h"
+
+#define STATE_MAGIC 0x74747466u // "tttf"
+#define STATE_VERSION 1
+#define STATE_HEADER_SIZE 64    // 세션 슬롯은 파일의 64바이트 위치부터
+
+typedef struct
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t rows, cols, k; // 게임판 (다른 설정으로 켜면 이어 두지 않음)
+    uint32_t sessions;
+    uint32_t slot_size;     // 복사본 하나의 크기 (세션마다 두 개)
+    uint32_t reserved;
+    char server[32];
+} StateHeader;
+
+typedef struct
+{
+    uint32_t checksum; // seq 부터 복사본 끝까지의 FNV-1a
+    uint32_t seq;      // 저장할 때마다 1 증가 (0: 아직 저장하지 않음), 유효한 복사본 중 큰 쪽이 최신
+    int32_t moves;
+    int16_t last_row, last_col;
+    int8_t turn;
+    int8_t winner;     // -1: 진행 중 또는 중단, 0 또는 1: 승자, 2: 무승부
+    int8_t over;       // 끝난 게임 (승부가 났거나 연결이 끊겨 중단됨)
+    int8_t connected[2];
+    int8_t cells[];    // rows * cols, MNK_EMPTY, 0, 1
+} StateSlot;
+
+typedef struct // 저장하거나 불러온 세션 상태 하나
+{
+    int turn, winner, over;
+    int connected[2]; // 접속했던 플레이어 (서버 봇 자리는 1)
+    int last_row, last_col;
+    int moves;
+    signed char cells[MNK_MAX_CELLS];
+} StateSnapshot;
+
+typedef struct
+{
+    StateHeader *header; // NULL: 열지 않음
+    size_t size;
+    int cells;           // rows * cols
+    uint32_t *seq;       // 세션별 마지막으로 저장한 seq
+} StateFile;
+
+_Static_assert(sizeof(StateHeader) <= STATE_HEADER_SIZE, "state header must fit before the slots");
+
+// 상태 파일 열기: 1: 같은 설정의 기존 파일 (state_load 로 이어 둠), 0: 새로 만듦, -1: 실패 또는 설정이 다름
+int state_open(StateFile *file, const char *path, const char *server, int sessions, int rows, int cols, int k);
+void state_close(StateFile *file);
+int state_load(StateFile *file, int session, StateSnapshot *snapshot); // 0: 유효한 상태, -1: 저장된 적 없음 또는 손상
+void state_save(StateFile *file, int session, const StateSnapshot *snapshot);
+
+#endif
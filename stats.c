@@ -0,0 +1,86 @@
+// stats.c
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "stats.h"
+
+const char *const stats_counter_names[STATS_COUNTERS] = {"moves", "invalid moves", "games started", "games finished"};
+const char *const stats_timer_names[STATS_TIMERS] = {"wait", "write", "read", "lock hold"};
+
+static StatsSegment local_segment; // 세그먼트를 열기 전이나 열지 못했을 때의 기록 대상
+static StatsSegment *segment = &local_segment;
+static char segment_name[64];
+static atomic_uint next_shard;
+static __thread int shard_index = -1;
+
+int stats_open(const char *name, const char *server)
+{
+    int fd = shm_open(name, O_CREAT | O_RDWR, 0644);
+    if (fd == -1)
+    {
+        perror("shm_open stats failed");
+        return -1;
+    }
+    if (ftruncate(fd, sizeof(StatsSegment)) == -1)
+    {
+        perror("ftruncate stats failed");
+        close(fd);
+        return -1;
+    }
+    StatsSegment *mapped = mmap(NULL, sizeof(StatsSegment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED)
+    {
+        perror("mmap stats failed");
+        return -1;
+    }
+
+    // 이전 실행이 남긴 값은 지우고, 머리 정보는 마지막에 채워 읽는 쪽이 완성된 세그먼트만 보게 함
+    memset(mapped, 0, sizeof(StatsSegment));
+    mapped->pid = (int32_t)getpid();
+    mapped->shards = STATS_SHARDS;
+    mapped->start_ns = stats_now_ns();
+    snprintf(mapped->server, sizeof(mapped->server), "%s", server);
+    mapped->version = STATS_VERSION;
+    atomic_thread_fence(memory_order_release);
+    mapped->magic = STATS_MAGIC;
+
+    snprintf(segment_name, sizeof(segment_name), "%s", name);
+    segment = mapped;
+    return 0;
+}
+
+void stats_close(void)
+{
+    if (segment == &local_segment)
+        return;
+    munmap(segment, sizeof(StatsSegment));
+    shm_unlink(segment_name);
+    segment = &local_segment;
+}
+
+static StatsShard *current_shard(void)
+{
+    if (shard_index == -1)
+        shard_index = (int)(atomic_fetch_add_explicit(&next_shard, 1, memory_order_relaxed) % STATS_SHARDS);
+    return &segment->shard[shard_index];
+}
+
+void stats_count(StatsCounter counter, uint64_t n)
+{
+    atomic_fetch_add_explicit(&current_shard()->counters[counter], n, memory_order_relaxed);
+}
+
+void stats_time(StatsTimer timer, uint64_t ns)
+{
+    StatsHistogram *histogram = &current_shard()->timers[timer];
+    atomic_fetch_add_explicit(&histogram->count, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&histogram->total_ns, ns, memory_order_relaxed);
+    atomic_fetch_add_explicit(&histogram->buckets[stats_bucket(ns)], 1, memory_order_relaxed);
+    uint64_t max = atomic_load_explicit(&histogram->max_ns, memory_order_relaxed);
+    while (ns > max &&
+           !atomic_compare_exchange_weak_explicit(&histogram->max_ns, &max, ns, memory_order_relaxed, memory_order_relaxed))
+        ;
+}
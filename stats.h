@@ -0,0 +1,91 @@
+// stats.h
+// 항상 켜져 있는 서버 통계: 이름 있는 POSIX 공유 메모리(/dev/shm)에 카운터와 지연 히스토그램을 기록
+//  ttt-stats 가 읽기 전용으로 붙어서 주기적으로 읽음 (서버는 잠금 없이 relaxed 원자 연산만 하므로 멈추지 않음)
+//  스레드마다 조각(shard) 하나에 기록해서 여러 코어가 같은 캐시 줄을 두고 다투지 않음, 읽는 쪽이 조각을 합산
+//  세그먼트를 열지 않은 프로세스(벤치마크 등)는 프로세스 안의 정적 영역에 기록
+#ifndef STATS_H
+#define STATS_H
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <time.h>
+
+#define STATS_NAME_PIPE "/ttt_stats_pipe" // FIFO 서버 (pipe_server)
+#define STATS_NAME_SOCK "/ttt_stats_sock" // 소켓 서버 (sock_server)
+#define STATS_NAME_SHM "/ttt_stats_shm"   // 공유 메모리 서버 (shmserver)
+#define STATS_MAGIC 0x74747473u           // "ttts"
+#define STATS_VERSION 1
+#define STATS_SHARDS 16  // 조각 수 (스레드는 처음 기록할 때 차례로 배정)
+#define STATS_BUCKETS 64 // 버킷 i: [2^i, 2^(i+1)) ns, 0ns 는 버킷 0
+#define STATS_SERVER_MAX 32
+
+typedef enum
+{
+    STATS_MOVES,          // 처리한 수
+    STATS_INVALID_MOVES,  // 거부한 수 (차례가 아님, 잘못된 칸)
+    STATS_GAMES_STARTED,
+    STATS_GAMES_FINISHED,
+    STATS_COUNTERS
+} StatsCounter;
+
+typedef enum
+{
+    STATS_WAIT,      // 차례 대기 (sem_wait, 공유 메모리 서버는 명령 이벤트 대기)
+    STATS_WRITE,     // 메시지 쓰기 시스템 호출 (FIFO, 소켓)
+    STATS_READ,      // 메시지 읽기 시스템 호출 (블로킹 FIFO 는 상대가 보낼 때까지 기다린 시간 포함)
+    STATS_LOCK_HOLD, // 게임 잠금 보유 시간 (game_mutex)
+    STATS_TIMERS
+} StatsTimer;
+
+typedef struct
+{
+    _Atomic uint64_t count;
+    _Atomic uint64_t total_ns;
+    _Atomic uint64_t max_ns;
+    _Atomic uint64_t buckets[STATS_BUCKETS];
+} StatsHistogram;
+
+typedef struct
+{
+    _Alignas(64) _Atomic uint64_t counters[STATS_COUNTERS];
+    StatsHistogram timers[STATS_TIMERS];
+} StatsShard;
+
+typedef struct
+{
+    uint32_t magic;
+    uint32_t version;
+    int32_t pid;               // 기록하는 서버 프로세스 (ttt-stats 가 살아 있는지 확인)
+    uint32_t shards;
+    uint64_t start_ns;         // 서버 시작 시각 (CLOCK_MONOTONIC)
+    char server[STATS_SERVER_MAX];
+    StatsShard shard[STATS_SHARDS];
+} StatsSegment;
+
+extern const char *const stats_counter_names[STATS_COUNTERS];
+extern const char *const stats_timer_names[STATS_TIMERS];
+
+int stats_open(const char *name, const char *server); // 세그먼트 생성, -1: 실패 (프로세스 안 영역에 계속 기록)
+void stats_close(void);                               // 세그먼트 해제 및 이름 삭제
+void stats_count(StatsCounter counter, uint64_t n);
+void stats_time(StatsTimer timer, uint64_t ns);
+
+static inline uint64_t stats_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// 히스토그램 버킷 번호와 버킷의 상한 (ns)
+static inline int stats_bucket(uint64_t ns)
+{
+    return ns == 0 ? 0 : 63 - __builtin_clzll(ns);
+}
+
+static inline uint64_t stats_bucket_upper(int bucket)
+{
+    return bucket >= 63 ? UINT64_MAX : (2ull << bucket);
+}
+
+#endif
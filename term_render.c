@@ -0,0 +1,112 @@
+// term_render.c
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "term_render.h"
+
+#define BOARD_TOP_ROW 3
+
+void term_render_init(TermRender* render) {
+    pthread_mutex_init(&render->lock, NULL);
+    render->drawn = 0;
+    render->generation = 0;
+    memset(render->cells, ' ', sizeof(render->cells));
+    render->status[0] = '\0';
+}
+
+void term_render_destroy(TermRender* render) {
+    pthread_mutex_destroy(&render->lock);
+}
+
+// 칸 번호의 화면 좌표 (1부터 시작): " X | O | X " 의 2, 6, 10열
+static void cell_position(int cell, int* row, int* col) {
+    *row = BOARD_TOP_ROW + (cell / TTT_SIDE) * 2;
+    *col = 2 + (cell % TTT_SIDE) * 4;
+}
+
+static size_t append(char* out, size_t size, size_t len, const char* text) {
+    size_t n = strlen(text);
+    if (len + n >= size) {
+        return len;
+    }
+    memcpy(out + len, text, n);
+    return len + n;
+}
+
+// 처음 한 번: 화면을 지우고 상태 줄과 게임판 전체를 그림 (커서는 입력 영역에 남음)
+static size_t full_frame(TermRender* render, const TttBoard* board, const char* status, char* out, size_t size) {
+    size_t len = append(out, size, 0, "\033[H\033[2J");
+    len = append(out, size, len, status);
+    len = append(out, size, len, "\n\n");
+    for (int i = 0; i < TTT_CELLS; i++) {
+        char cell[8];
+        render->cells[i] = ttt_cell_char(board, i);
+        snprintf(cell, sizeof(cell), " %c %s", render->cells[i], (i + 1) % TTT_SIDE == 0 ? "\n" : "|");
+        len = append(out, size, len, cell);
+        if ((i + 1) % TTT_SIDE == 0 && i < TTT_CELLS - 1) {
+            len = append(out, size, len, "---+---+---\n");
+        }
+    }
+    len = append(out, size, len, "\n");
+    snprintf(render->status, sizeof(render->status), "%s", status);
+    render->drawn = 1;
+    return len;
+}
+
+size_t term_render_frame(TermRender* render, uint32_t generation, const TttBoard* board,
+                         const char* status, char* out, size_t size) {
+    if (!render->drawn) {
+        render->generation = generation;
+        return full_frame(render, board, status, out, size);
+    }
+    if (generation == render->generation && strcmp(status, render->status) == 0) {
+        return 0; // 바뀐 것 없음
+    }
+    render->generation = generation;
+
+    // 커서 위치를 저장해 두고 바뀐 부분만 덮어쓴 뒤 복원 (입력 중인 줄을 건드리지 않음)
+    size_t len = append(out, size, 0, "\0337");
+    for (int i = 0; i < TTT_CELLS; i++) {
+        char c = ttt_cell_char(board, i);
+        if (c == render->cells[i]) {
+            continue;
+        }
+        int row, col;
+        char move[24];
+        cell_position(i, &row, &col);
+        snprintf(move, sizeof(move), "\033[%d;%dH%c", row, col, c);
+        len = append(out, size, len, move);
+        render->cells[i] = c;
+    }
+    if (strcmp(status, render->status) != 0) {
+        len = append(out, size, len, "\033[1;1H\033[2K");
+        len = append(out, size, len, status);
+        snprintf(render->status, sizeof(render->status), "%s", status);
+    }
+    return append(out, size, len, "\0338");
+}
+
+size_t term_render_update(TermRender* render, uint32_t generation, const TttBoard* board, const char* status) {
+    char frame[TERM_FRAME_MAX];
+    pthread_mutex_lock(&render->lock);
+    size_t len = term_render_frame(render, generation, board, status, frame, sizeof(frame));
+    if (len > 0) {
+        fflush(stdout); // printf 로 쓴 내용과 순서를 맞춤
+        if (write(STDOUT_FILENO, frame, len) == -1) {
+            len = 0;
+        }
+    }
+    pthread_mutex_unlock(&render->lock);
+    return len;
+}
+
+void term_render_prompt(TermRender* render) {
+    char move[24];
+    int len = snprintf(move, sizeof(move), "\033[%d;1H\033[J", TERM_PROMPT_ROW);
+    pthread_mutex_lock(&render->lock);
+    fflush(stdout);
+    if (write(STDOUT_FILENO, move, len) == -1) {
+        perror("write failed");
+    }
+    pthread_mutex_unlock(&render->lock);
+}
@@ -0,0 +1,37 @@
+// term_render.h
+// 3x3 게임판 터미널 렌더러 (shmserver / shmclient 공용)
+//  처음 한 번만 화면을 지우고 틀을 그린 뒤, 이후에는 바뀐 칸과 상태 줄만 ANSI 커서 이동으로 덮어씀
+//  화면 구성: 1행 상태 줄, 3~7행 게임판, TERM_PROMPT_ROW 행부터 입력/메시지 영역
+//  system("clear") 처럼 프로세스를 만들지 않으며, 한 번의 갱신은 write 한 번으로 출력
+#ifndef TERM_RENDER_H
+#define TERM_RENDER_H
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ttt_engine.h"
+
+#define TERM_STATUS_MAX 128
+#define TERM_PROMPT_ROW 9
+#define TERM_FRAME_MAX 1024
+
+typedef struct {
+    pthread_mutex_t lock;            // 같은 프로세스의 여러 스레드가 그릴 때 (게임 잠금과 별개)
+    int drawn;                       // 틀을 그렸는지
+    uint32_t generation;             // 마지막으로 그린 게임판 세대
+    char cells[TTT_CELLS];           // 화면에 그려진 칸
+    char status[TERM_STATUS_MAX];    // 화면에 그려진 상태 줄
+} TermRender;
+
+void term_render_init(TermRender* render);
+void term_render_destroy(TermRender* render);
+
+// 화면에 보낼 바이트를 out 에 작성하고 길이 반환 (바뀐 것이 없으면 0)
+size_t term_render_frame(TermRender* render, uint32_t generation, const TttBoard* board,
+                         const char* status, char* out, size_t size);
+// 세대가 바뀌었을 때만 그림 (stdout 을 먼저 비우고 write 한 번), 출력한 바이트 수 반환
+size_t term_render_update(TermRender* render, uint32_t generation, const TttBoard* board, const char* status);
+// 입력 영역으로 커서를 옮기고 그 아래를 지움
+void term_render_prompt(TermRender* render);
+
+#endif
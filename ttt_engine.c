@@ -0,0 +1,93 @@
+// ttt_engine.c
+#include "ttt_engine.h"
+
+const uint16_t ttt_win_masks[TTT_LINES] = {
+    0x007, 0x038, 0x1c0, // 가로
+    0x049, 0x092, 0x124, // 세로
+    0x111, 0x054         // 대각선
+};
+
+// 9비트 마스크 512개 각각이 승리 줄을 하나라도 포함하는지 나타내는 비트 테이블
+//  비트 m = ((m & ttt_win_masks[i]) == ttt_win_masks[i]) 인 i 가 존재하는가
+static const uint64_t win_table[512 / 64] = {
+    0xff80808080808080ull,
+    0xfff0aa80faf0aa80ull,
+    0xffcc8080cccc8080ull,
+    0xfffcaa80fefcaa80ull,
+    0xfffaf0f0aaaa8080ull,
+    0xfffafaf0fafaaa80ull,
+    0xfffef0f0eeee8080ull,
+    0xffffffffffffffffull,
+};
+
+// 칸 i 의 3진수 자릿값 3^i
+static const uint16_t pow3[TTT_CELLS] = {1, 3, 9, 27, 81, 243, 729, 2187, 6561};
+
+static inline int mask_wins(unsigned mask)
+{
+    return (int)((win_table[mask >> 6] >> (mask & 63)) & 1);
+}
+
+void ttt_init(TttBoard *board)
+{
+    board->mask[0] = 0;
+    board->mask[1] = 0;
+    board->index = 0;
+}
+
+int ttt_place(TttBoard *board, int player, int cell)
+{
+    if (cell < 0 || cell >= TTT_CELLS)
+        return -1; // 잘못된 좌표
+    uint16_t bit = (uint16_t)(1u << cell);
+    if ((board->mask[0] | board->mask[1]) & bit)
+        return -1; // 이미 수가 존재함
+    board->mask[player] |= bit;
+    board->index += (uint16_t)((player + 1) * pow3[cell]);
+    return 0;
+}
+
+int ttt_cell(const TttBoard *board, int cell)
+{
+    uint16_t bit = (uint16_t)(1u << cell);
+    if (board->mask[0] & bit)
+        return 0;
+    if (board->mask[1] & bit)
+        return 1;
+    return -1;
+}
+
+char ttt_cell_char(const TttBoard *board, int cell)
+{
+    static const char symbols[3] = {' ', 'X', 'O'};
+    return symbols[ttt_cell(board, cell) + 1];
+}
+
+int ttt_winner(const TttBoard *board)
+{
+    if (mask_wins(board->mask[0]))
+        return 0;
+    if (mask_wins(board->mask[1]))
+        return 1;
+    return -1;
+}
+
+int ttt_winning_line(const TttBoard *board)
+{
+    for (int p = 0; p < 2; p++)
+    {
+        if (!mask_wins(board->mask[p]))
+            continue;
+        for (int i = 0; i < TTT_LINES; i++)
+        {
+            if ((board->mask[p] & ttt_win_masks[i]) == ttt_win_masks[i])
+                return i;
+        }
+    }
+    return -1;
+}
+
+int ttt_is_full(const TttBoard *board)
+{
+    return __builtin_popcount((unsigned)(board->mask[0] | board->mask[1])) == TTT_CELLS;
+}
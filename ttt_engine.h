@@ -0,0 +1,32 @@
+// ttt_engine.h
+// 3x3 틱택토 공용 게임 엔진 (pipe_server / shmserver 공용)
+//  플레이어마다 9비트 마스크로 게임판을 저장 (비트 i = 칸 i, 칸 번호는 row * 3 + col)
+//  수를 둘 때마다 3진수 인덱스도 함께 갱신 (칸 i 가 빈 칸이면 0, X 면 1, O 면 2 를 3^i 에 곱한 합)
+#ifndef TTT_ENGINE_H
+#define TTT_ENGINE_H
+
+#include <stdint.h>
+
+#define TTT_SIDE 3   // 한 변의 길이
+#define TTT_CELLS 9  // 칸 수
+#define TTT_LINES 8  // 승리 줄 수 (가로 3, 세로 3, 대각선 2)
+#define TTT_FULL_MASK 0x1ff
+
+typedef struct
+{
+    uint16_t mask[2]; // 플레이어 0(X), 1(O)의 돌 위치
+    uint16_t index;   // 3진수 인덱스 (0 ~ 3^9 - 1), 미리 계산한 표의 조회 키
+} TttBoard;
+
+// 승리 줄 마스크: 0~2 가로, 3~5 세로, 6~7 대각선
+extern const uint16_t ttt_win_masks[TTT_LINES];
+
+void ttt_init(TttBoard *board);
+int ttt_place(TttBoard *board, int player, int cell); // 0: 성공, -1: 잘못된 칸 또는 이미 놓임
+int ttt_cell(const TttBoard *board, int cell);        // -1: 빈 칸, 0 또는 1: 플레이어
+char ttt_cell_char(const TttBoard *board, int cell);  // ' ', 'X', 'O'
+int ttt_winner(const TttBoard *board);                // -1: 승자 없음, 0 또는 1: 승자
+int ttt_winning_line(const TttBoard *board);          // 완성된 줄 번호 (0~7), 없으면 -1
+int ttt_is_full(const TttBoard *board);               // 빈 칸이 없으면 1
+
+#endif
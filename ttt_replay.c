@@ -0,0 +1,193 @@
+// ttt_replay.c
+// ttt-replay: 서버가 남긴 이진 수 기록(journal)을 게임 엔진으로 최대 속도로 다시 두어 결과를 검증
+//  수마다 차례와 칸이 맞는지, 게임 종료 레코드의 결과가 엔진의 판정과 같은지 확인
+//  서버가 도중에 죽은 기록도 읽음: 끝나지 않은 게임과 쓰다 만 레코드는 따로 셈
+//  사용법: ./ttt-replay journal...   (어긋난 게임이 있으면 종료 코드 1)
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "journal.h"
+#include "pipe_session.h"
+#include "stats.h"
+
+#define REPLAY_MAX_SESSIONS (1 << 20) // 이보다 큰 세션 번호는 손상된 기록으로 봄
+#define REPLAY_MAX_ERRORS 10          // 자세히 출력할 어긋남 수
+
+typedef struct
+{
+    GameState game;
+    int active; // 첫 수 이후 종료 레코드 전까지 1
+} ReplayGame;
+
+typedef struct
+{
+    uint64_t moves, games, mismatched, incomplete, torn;
+} ReplayResult;
+
+static void report_error(ReplayResult *result, uint64_t index, const JournalRecord *record, const char *what)
+{
+    if (result->mismatched++ < REPLAY_MAX_ERRORS)
+        fprintf(stderr, "  record %lu (session %u, player %u, cell %u): %s\n", (unsigned long)index,
+                record->session, record->player, record->cell, what);
+}
+
+static void replay_records(const JournalHeader *header, const JournalRecord *records, uint64_t count,
+                           ReplayGame *games, ReplayResult *result)
+{
+    int cells = (int)(header->rows * header->cols);
+    for (uint64_t i = 0; i < count; i++)
+    {
+        const JournalRecord *record = &records[i];
+        uint8_t type = atomic_load_explicit(&((JournalRecord *)record)->type, memory_order_acquire);
+        if (type == JOURNAL_EMPTY)
+        {
+            result->torn++;
+            continue;
+        }
+        ReplayGame *g = &games[record->session];
+        if (!g->active)
+        {
+            init_game(&g->game, (int)header->rows, (int)header->cols, (int)header->k);
+            g->active = 1;
+        }
+        GameState *game = &g->game;
+
+        if (type == JOURNAL_MOVE)
+        {
+            result->moves++;
+            if (game->winner != -1)
+                report_error(result, i, record, "move after the game was decided");
+            else if (record->player != game->turn)
+                report_error(result, i, record, "move out of turn");
+            else if (record->cell >= cells || make_move(game, record->player, record->cell / (int)header->cols,
+                                                        record->cell % (int)header->cols) == -1)
+                report_error(result, i, record, "illegal move");
+            else if ((game->winner = check_result(game)) == -1)
+                game->turn = 1 - game->turn;
+            continue;
+        }
+        if (type != JOURNAL_END)
+        {
+            report_error(result, i, record, "unknown record type");
+            continue;
+        }
+
+        // 종료 레코드: 기록된 결과와 엔진의 판정 비교 (중단된 게임은 아직 진행 중이어야 함)
+        int expected = record->player == JOURNAL_ABORTED ? -1 : record->player;
+        if (expected != game->winner)
+        {
+            char what[96];
+            snprintf(what, sizeof(what), "recorded result %d, engine says %d", expected, game->winner);
+            report_error(result, i, record, what);
+        }
+        result->games++;
+        g->active = 0;
+    }
+}
+
+static int replay_file(const char *path)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd == -1)
+    {
+        perror(path);
+        return -1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) == -1 || (size_t)st.st_size < JOURNAL_HEADER_SIZE)
+    {
+        fprintf(stderr, "%s: too short for a journal\n", path);
+        close(fd);
+        return -1;
+    }
+    void *map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+    {
+        perror("mmap journal failed");
+        return -1;
+    }
+
+    const JournalHeader *header = map;
+    if (header->magic != JOURNAL_MAGIC || header->version != JOURNAL_VERSION ||
+        header->record_size != sizeof(JournalRecord))
+    {
+        fprintf(stderr, "%s: not a journal of this version\n", path);
+        munmap(map, (size_t)st.st_size);
+        return -1;
+    }
+    GameState probe;
+    if (init_game(&probe, (int)header->rows, (int)header->cols, (int)header->k) == -1)
+    {
+        fprintf(stderr, "%s: invalid board %ux%u, k=%u\n", path, header->rows, header->cols, header->k);
+        munmap(map, (size_t)st.st_size);
+        return -1;
+    }
+
+    // 기록된 레코드 수: 예약한 수, 잡아 둔 크기, 실제 파일 크기 중 가장 작은 값 (넘친 기록과 잘린 파일)
+    const JournalRecord *records = (const JournalRecord *)((const char *)map + JOURNAL_HEADER_SIZE);
+    uint64_t count = atomic_load(&((JournalHeader *)header)->next);
+    uint64_t in_file = ((uint64_t)st.st_size - JOURNAL_HEADER_SIZE) / sizeof(JournalRecord);
+    uint64_t dropped = count > header->capacity ? count - header->capacity : 0;
+    if (count > header->capacity)
+        count = header->capacity;
+    if (count > in_file)
+        count = in_file;
+
+    uint32_t max_session = 0;
+    for (uint64_t i = 0; i < count; i++)
+        if (records[i].session > max_session)
+            max_session = records[i].session;
+    if (max_session >= REPLAY_MAX_SESSIONS)
+    {
+        fprintf(stderr, "%s: session id %u out of range\n", path, max_session);
+        munmap(map, (size_t)st.st_size);
+        return -1;
+    }
+    ReplayGame *games = calloc((size_t)max_session + 1, sizeof(ReplayGame));
+    if (games == NULL)
+    {
+        perror("calloc replay games failed");
+        munmap(map, (size_t)st.st_size);
+        return -1;
+    }
+
+    ReplayResult result = {0};
+    uint64_t start = stats_now_ns();
+    replay_records(header, records, count, games, &result);
+    uint64_t elapsed = stats_now_ns() - start;
+    for (uint32_t s = 0; s <= max_session; s++)
+        result.incomplete += (uint64_t)games[s].active;
+
+    printf("%s: %s, %ux%u k=%u, %lu records", path, header->server, header->rows, header->cols, header->k,
+           (unsigned long)count);
+    if (dropped > 0)
+        printf(" (%lu dropped: journal was full)", (unsigned long)dropped);
+    printf("\n  games %lu, moves %lu, mismatched %lu, incomplete %lu, torn records %lu\n",
+           (unsigned long)result.games, (unsigned long)result.moves, (unsigned long)result.mismatched,
+           (unsigned long)result.incomplete, (unsigned long)result.torn);
+    printf("  replay %.3f ms (%.1f M records/sec)\n", elapsed / 1e6,
+           elapsed > 0 ? count * 1e3 / elapsed : 0.0);
+    fflush(stdout);
+
+    free(games);
+    munmap(map, (size_t)st.st_size);
+    return result.mismatched == 0 ? 0 : -1;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "Usage: %s journal...\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    int failed = 0;
+    for (int i = 1; i < argc; i++)
+        failed |= replay_file(argv[i]) == -1;
+    return failed ? EXIT_FAILURE : 0;
+}
@@ -0,0 +1,109 @@
+// ttt_solve_gen.c
+// 빌드 도구: 3x3 틱택토를 완전 탐색으로 풀어 ttt_solved_table.c 를 표준 출력으로 생성
+//  빈 게임판에서 정상적으로 둘 수 있는 배치만 방문하며, 각 배치의 미니맥스 값과 최선의 수를 기록
+//  점수는 빨리 이길수록, 늦게 질수록 좋게 매김 (같은 점수면 번호가 작은 칸)
+//  게임 상태 표는 3진수 인덱스 전체(3^9개)를 풀어 승자/무승부와 완성된 줄을 기록
+#include <stdio.h>
+#include <string.h>
+#include "ttt_engine.h"
+#include "ttt_solved.h"
+
+#define WIN_SCORE 10 // 승패 점수의 기본값 (남은 빈 칸 수만큼 더함)
+
+static uint8_t table[TTT_POSITIONS];
+static uint8_t terminal[TTT_POSITIONS];
+static int solved[TTT_POSITIONS]; // 0: 아직 방문 안 함
+static int scores[TTT_POSITIONS];
+static int reachable;
+
+static int empty_cells(const TttBoard *board)
+{
+    return TTT_CELLS - __builtin_popcount(board->mask[0] | board->mask[1]);
+}
+
+// 둘 차례인 쪽 기준 점수 (메모이제이션)
+static int solve(const TttBoard *board, int player)
+{
+    int index = ttt_index(board);
+    if (solved[index])
+        return scores[index];
+    solved[index] = 1;
+    reachable++;
+
+    int score, best = TTT_SOLVED_NO_MOVE;
+    if (ttt_winner(board) != -1)
+        score = -(WIN_SCORE + empty_cells(board)); // 직전에 상대가 이김
+    else if (ttt_is_full(board))
+        score = 0;
+    else
+    {
+        score = -2 * WIN_SCORE - TTT_CELLS;
+        for (int cell = 0; cell < TTT_CELLS; cell++)
+        {
+            TttBoard next = *board;
+            if (ttt_place(&next, player, cell) == -1)
+                continue;
+            int child = -solve(&next, 1 - player);
+            if (child > score)
+            {
+                score = child;
+                best = cell;
+            }
+        }
+    }
+    int value = score > 0 ? 1 : (score < 0 ? -1 : 0);
+    table[index] = (uint8_t)(best | (value + 1) << 4);
+    scores[index] = score;
+    return score;
+}
+
+// 3진수 인덱스 하나의 게임 상태 (두 플레이어가 모두 줄을 완성한 배치는 도달 불가이므로 X 우선)
+static uint8_t terminal_entry(int index)
+{
+    TttBoard board;
+    ttt_init(&board);
+    for (int cell = 0; cell < TTT_CELLS; cell++, index /= 3)
+    {
+        if (index % 3 != 0)
+            ttt_place(&board, index % 3 - 1, cell);
+    }
+    int winner = ttt_winner(&board);
+    int state = TTT_STATE_PLAYING;
+    if (winner != -1)
+        state = winner == 0 ? TTT_STATE_X_WINS : TTT_STATE_O_WINS;
+    else if (ttt_is_full(&board))
+        state = TTT_STATE_DRAW;
+    return (uint8_t)(state | (ttt_winning_line(&board) + 1) << 4);
+}
+
+static void print_array(const char *decl, const uint8_t *data, int count)
+{
+    printf("%s = {", decl);
+    for (int i = 0; i < count; i++)
+    {
+        if (i % 16 == 0)
+            printf("\n   ");
+        printf(" %d,", data[i]);
+    }
+    printf("\n};\n\n");
+}
+
+int main(void)
+{
+    for (int index = 0; index < TTT_POSITIONS; index++)
+        terminal[index] = terminal_entry(index);
+    memset(table, TTT_SOLVED_UNREACHABLE, sizeof(table));
+
+    TttBoard empty;
+    ttt_init(&empty);
+    int root = solve(&empty, 0);
+
+    printf("// ttt_solved_table.c\n");
+    printf("// ttt_solve_gen 이 생성한 파일 (직접 고치지 말 것)\n");
+    printf("// 도달 가능한 배치 %d개, 빈 게임판의 값: %s\n", reachable,
+           root > 0 ? "선공 승" : (root < 0 ? "후공 승" : "무승부"));
+    printf("#include \"ttt_solved.h\"\n\n");
+    print_array("const uint8_t ttt_solved[TTT_POSITIONS]", table, TTT_POSITIONS);
+    print_array("const uint8_t ttt_terminal[TTT_POSITIONS]", terminal, TTT_POSITIONS);
+    return 0;
+}
@@ -0,0 +1,48 @@
+// ttt_solved.h
+// 미리 푼 3x3 틱택토 표: 도달 가능한 모든 배치의 미니맥스 값과 최선의 수, 모든 배치의 게임 상태
+//  표는 빌드할 때 ttt_solve_gen 이 완전 탐색으로 만들어 ttt_solved_table.c 로 출력 (실행 중 탐색 없음)
+//  게임판은 엔진이 수마다 갱신하는 3진수 인덱스(TttBoard.index)로 바로 찾음
+#ifndef TTT_SOLVED_H
+#define TTT_SOLVED_H
+
+#include <stdint.h>
+#include "ttt_engine.h"
+
+#define TTT_POSITIONS 19683      // 3^9
+#define TTT_SOLVED_NO_MOVE 0x0f  // 항목의 수 자리: 게임이 끝나 둘 수 없음
+#define TTT_SOLVED_UNREACHABLE 0xff // 정상적인 진행으로는 나올 수 없는 배치
+
+// 항목 = 최선의 칸(하위 4비트) | (값 + 1) << 4, 값은 둘 차례인 쪽 기준 1: 승, 0: 무, -1: 패
+#define TTT_SOLVED_CELL(entry) ((entry) & 0x0f)
+#define TTT_SOLVED_VALUE(entry) (((entry) >> 4) - 1)
+
+// 게임 상태 항목 = 상태(하위 2비트) | (완성된 줄 번호 + 1) << 4 (줄이 없으면 0)
+#define TTT_STATE_PLAYING 0 // 진행 중
+#define TTT_STATE_X_WINS 1  // 플레이어 0 승리
+#define TTT_STATE_O_WINS 2  // 플레이어 1 승리
+#define TTT_STATE_DRAW 3    // 무승부
+#define TTT_STATE_RESULT(entry) ((entry) & 0x03)
+#define TTT_STATE_LINE(entry) (((entry) >> 4) - 1) // 완성된 줄 (0~7), 없으면 -1
+
+extern const uint8_t ttt_solved[TTT_POSITIONS];
+extern const uint8_t ttt_terminal[TTT_POSITIONS]; // 모든 3진수 인덱스의 게임 상태 (도달 불가 배치 포함)
+
+static inline int ttt_index(const TttBoard *board)
+{
+    return board->index;
+}
+
+// 게임 종료 판정: 줄 검사나 빈 칸 세기 없이 표 조회 한 번
+static inline uint8_t ttt_state(const TttBoard *board)
+{
+    return ttt_terminal[board->index];
+}
+
+// 둘 차례인 쪽의 최선의 칸 (0~8), 끝났거나 도달할 수 없는 배치면 -1
+static inline int ttt_solved_move(const TttBoard *board)
+{
+    int cell = TTT_SOLVED_CELL(ttt_solved[ttt_index(board)]);
+    return cell == TTT_SOLVED_NO_MOVE ? -1 : cell;
+}
+
+#endif
@@ -0,0 +1,174 @@
+// ttt_stats.c
+// ttt-stats: 실행 중인 서버의 통계 세그먼트에 읽기 전용으로 붙어 주기마다 증가율과 지연 분포를 출력
+//  서버는 잠금 없이 기록하므로 읽는 동안에도 멈추지 않음 (조각별 값을 relaxed 로 읽어 합산)
+//  사용법: ./ttt-stats [-i interval_ms] [-n samples] [segment_name]
+//          이름을 주지 않으면 pipe, sock, shm 서버 순서로 먼저 열리는 세그먼트
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "stats.h"
+
+typedef struct
+{
+    uint64_t counters[STATS_COUNTERS];
+    uint64_t count[STATS_TIMERS], total_ns[STATS_TIMERS], max_ns[STATS_TIMERS];
+    uint64_t buckets[STATS_TIMERS][STATS_BUCKETS];
+    uint64_t taken_ns;
+} Snapshot;
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s [-i interval_ms] [-n samples] [segment_name]\n", prog);
+    fprintf(stderr, "  segment_name: %s, %s, %s (기본: 먼저 열리는 것)\n", STATS_NAME_PIPE, STATS_NAME_SOCK,
+            STATS_NAME_SHM);
+    exit(EXIT_FAILURE);
+}
+
+static const StatsSegment *attach(const char *name)
+{
+    int fd = shm_open(name, O_RDONLY, 0);
+    if (fd == -1)
+        return NULL;
+    struct stat st;
+    if (fstat(fd, &st) == -1 || (size_t)st.st_size < sizeof(StatsSegment))
+    {
+        close(fd);
+        return NULL;
+    }
+    const StatsSegment *segment = mmap(NULL, sizeof(StatsSegment), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (segment == MAP_FAILED)
+        return NULL;
+    if (segment->magic != STATS_MAGIC || segment->version != STATS_VERSION)
+    {
+        fprintf(stderr, "%s: not a stats segment of this version\n", name);
+        munmap((void *)segment, sizeof(StatsSegment));
+        return NULL;
+    }
+    return segment;
+}
+
+static void take(const StatsSegment *segment, Snapshot *snap)
+{
+    memset(snap, 0, sizeof(*snap));
+    for (uint32_t s = 0; s < segment->shards && s < STATS_SHARDS; s++)
+    {
+        const StatsShard *shard = &segment->shard[s];
+        for (int c = 0; c < STATS_COUNTERS; c++)
+            snap->counters[c] += atomic_load_explicit(&shard->counters[c], memory_order_relaxed);
+        for (int t = 0; t < STATS_TIMERS; t++)
+        {
+            const StatsHistogram *h = &shard->timers[t];
+            snap->count[t] += atomic_load_explicit(&h->count, memory_order_relaxed);
+            snap->total_ns[t] += atomic_load_explicit(&h->total_ns, memory_order_relaxed);
+            uint64_t max = atomic_load_explicit(&h->max_ns, memory_order_relaxed);
+            if (max > snap->max_ns[t])
+                snap->max_ns[t] = max;
+            for (int b = 0; b < STATS_BUCKETS; b++)
+                snap->buckets[t][b] += atomic_load_explicit(&h->buckets[b], memory_order_relaxed);
+        }
+    }
+    snap->taken_ns = stats_now_ns();
+}
+
+// 구간 히스토그램(두 스냅숏의 차)의 백분위수: 해당 버킷의 상한 (최댓값을 넘지 않게, us)
+static double percentile_us(const Snapshot *now, const Snapshot *prev, int timer, uint64_t count, double p)
+{
+    uint64_t rank = (uint64_t)(p * (double)(count - 1)) + 1, seen = 0;
+    for (int b = 0; b < STATS_BUCKETS; b++)
+    {
+        seen += now->buckets[timer][b] - prev->buckets[timer][b];
+        if (seen >= rank)
+        {
+            uint64_t upper = stats_bucket_upper(b);
+            return (upper < now->max_ns[timer] ? upper : now->max_ns[timer]) / 1e3;
+        }
+    }
+    return 0;
+}
+
+static void print_sample(const StatsSegment *segment, const Snapshot *now, const Snapshot *prev)
+{
+    double interval = (now->taken_ns - prev->taken_ns) / 1e9;
+    const char *state = kill(segment->pid, 0) == -1 && errno == ESRCH ? ", not running" : "";
+    printf("%s (pid %d%s), up %.1f s\n", segment->server, segment->pid, state,
+           (now->taken_ns - segment->start_ns) / 1e9);
+    printf("  %-16s %14s %12s\n", "counter", "total", "/sec");
+    for (int c = 0; c < STATS_COUNTERS; c++)
+        printf("  %-16s %14lu %12.1f\n", stats_counter_names[c], (unsigned long)now->counters[c],
+               (now->counters[c] - prev->counters[c]) / interval);
+    printf("  %-16s %12s %10s %10s %10s %10s\n", "timer", "/sec", "avg us", "p50 us", "p99 us", "max us");
+    for (int t = 0; t < STATS_TIMERS; t++)
+    {
+        uint64_t count = now->count[t] - prev->count[t];
+        if (count == 0)
+        {
+            printf("  %-16s %12.1f %10s %10s %10s %10.1f\n", stats_timer_names[t], 0.0, "-", "-", "-",
+                   now->max_ns[t] / 1e3);
+            continue;
+        }
+        printf("  %-16s %12.1f %10.2f %10.1f %10.1f %10.1f\n", stats_timer_names[t], count / interval,
+               (now->total_ns[t] - prev->total_ns[t]) / 1e3 / count, percentile_us(now, prev, t, count, 0.5),
+               percentile_us(now, prev, t, count, 0.99), now->max_ns[t] / 1e3);
+    }
+    printf("\n");
+    fflush(stdout);
+}
+
+int main(int argc, char *argv[])
+{
+    long interval_ms = 1000, samples = 0; // 0: 무한
+    int opt;
+    while ((opt = getopt(argc, argv, "i:n:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'i':
+            interval_ms = atol(optarg);
+            break;
+        case 'n':
+            samples = atol(optarg);
+            break;
+        default:
+            usage(argv[0]);
+        }
+    }
+    if (interval_ms <= 0 || samples < 0 || argc - optind > 1)
+        usage(argv[0]);
+
+    const StatsSegment *segment = NULL;
+    if (optind < argc)
+        segment = attach(argv[optind]);
+    else
+    {
+        const char *names[] = {STATS_NAME_PIPE, STATS_NAME_SOCK, STATS_NAME_SHM};
+        for (int i = 0; i < 3 && segment == NULL; i++)
+            segment = attach(names[i]);
+    }
+    if (segment == NULL)
+    {
+        fprintf(stderr, "no stats segment (is a server running?)\n");
+        return 1;
+    }
+
+    // 첫 구간은 서버 시작부터: 시작 시각과 0 을 이전 스냅숏으로 사용
+    Snapshot prev, now;
+    memset(&prev, 0, sizeof(prev));
+    prev.taken_ns = segment->start_ns;
+    for (long i = 0; samples == 0 || i < samples; i++)
+    {
+        if (i > 0)
+            usleep((useconds_t)(interval_ms * 1000));
+        take(segment, &now);
+        print_sample(segment, &now, &prev);
+        prev = now;
+    }
+    munmap((void *)segment, sizeof(StatsSegment));
+    return 0;
+}
@@ -0,0 +1,299 @@
+// ttt_tournament.c
+// ttt-tournament: 봇 전략끼리 한 프로세스 안에서 대국을 최대 속도로 두어 승/무/패 표를 만듦
+//  서버와 같은 규칙 (init_game, make_move, check_result), 터미널이나 게임마다 프로세스를 만들지 않음
+//  고른 전략의 모든 쌍(자기 자신 포함)이 -g 판씩 두며, 판마다 선수(플레이어 0)를 바꿈
+//  판 번호를 CHUNK_GAMES 개씩 묶어 스레드들이 가져가고, 묶음마다 난수 씨앗을 정하므로 스레드 수와 관계없이 결과가 같음
+//  잘못된 칸을 고른 전략은 그 판을 짐
+//  -S: 스레드 1, 2, 4, ... -t 개로 같은 대국을 반복해 초당 판 수와 확장 효율(스레드 1개 대비) 출력
+//  사용법: ./ttt-tournament [-g games_per_pair] [-t threads] [-b RxC] [-k k] [-p strategy,...] [-r seed] [-S]
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "bot_strategy.h"
+#include "stats.h"
+
+#define DEFAULT_GAMES_PER_PAIR 100000
+#define CHUNK_GAMES 4096   // 스레드가 한 번에 가져가는 판 수
+#define MAX_PLAYERS 16
+#define MAX_PAIRS (MAX_PLAYERS * (MAX_PLAYERS + 1) / 2)
+#define MAX_THREADS 256
+
+enum
+{
+    RESULT_A_WINS,
+    RESULT_DRAW,
+    RESULT_B_WINS,
+    RESULT_KINDS
+};
+
+typedef struct
+{
+    uint64_t results[MAX_PAIRS][RESULT_KINDS]; // 쌍의 첫 번째 전략(A) 기준
+    uint64_t moves;
+} Tally;
+
+typedef struct
+{
+    pthread_t tid;
+    _Alignas(64) Tally tally; // 스레드마다 따로 세고 끝난 뒤에 합침 (공유 카운터 없음)
+} Worker;
+
+static const BotStrategy *players[MAX_PLAYERS];
+static int player_count;
+static int pair_a[MAX_PAIRS], pair_b[MAX_PAIRS];
+static int pair_count;
+static uint64_t games_per_pair = DEFAULT_GAMES_PER_PAIR;
+static uint64_t total_games;
+static int rows = 3, cols = 3, k = 3;
+static unsigned base_seed = 1;
+static _Atomic uint64_t next_chunk;
+
+// 한 판: A 가 a_first 면 플레이어 0 (선수), 결과는 A 기준
+static int play_game(const BotStrategy *a, const BotStrategy *b, int a_first, unsigned *seed, uint64_t *moves)
+{
+    GameState game;
+    init_game(&game, rows, cols, k);
+    const BotStrategy *side[2] = {a_first ? a : b, a_first ? b : a};
+    while (game.winner == -1)
+    {
+        int cell = side[game.turn]->choose(&game, game.turn, seed);
+        if (cell == -1 || make_move(&game, game.turn, cell / cols, cell % cols) == -1)
+        {
+            game.winner = 1 - game.turn; // 잘못된 수: 기권패
+            break;
+        }
+        (*moves)++;
+        game.winner = check_result(&game);
+        if (game.winner == -1)
+            game.turn = 1 - game.turn;
+    }
+    if (game.winner == 2)
+        return RESULT_DRAW;
+    int a_player = a_first ? 0 : 1;
+    return game.winner == a_player ? RESULT_A_WINS : RESULT_B_WINS;
+}
+
+static void *tournament_worker(void *arg)
+{
+    Worker *worker = arg;
+    Tally *tally = &worker->tally;
+    memset(tally, 0, sizeof(*tally));
+    uint64_t chunks = (total_games + CHUNK_GAMES - 1) / CHUNK_GAMES;
+    for (;;)
+    {
+        uint64_t chunk = atomic_fetch_add_explicit(&next_chunk, 1, memory_order_relaxed);
+        if (chunk >= chunks)
+            break;
+        unsigned seed = base_seed + (unsigned)chunk * 2654435761u; // 묶음마다 정해진 씨앗
+        uint64_t end = (chunk + 1) * CHUNK_GAMES < total_games ? (chunk + 1) * CHUNK_GAMES : total_games;
+        for (uint64_t g = chunk * CHUNK_GAMES; g < end; g++)
+        {
+            int pair = (int)(g / games_per_pair);
+            int result = play_game(players[pair_a[pair]], players[pair_b[pair]], (g % games_per_pair) % 2 == 0,
+                                   &seed, &tally->moves);
+            tally->results[pair][result]++;
+        }
+    }
+    return NULL;
+}
+
+// 스레드 threads 개로 대국 전체를 두고 결과를 total 에 합침, 걸린 시간(ns) 반환
+static uint64_t run_tournament(int threads, Tally *total)
+{
+    Worker *workers = aligned_alloc(_Alignof(Worker), sizeof(Worker) * (size_t)threads);
+    atomic_store(&next_chunk, 0);
+    uint64_t start = stats_now_ns();
+    for (int t = 0; t < threads; t++)
+    {
+        if (pthread_create(&workers[t].tid, NULL, tournament_worker, &workers[t]) != 0)
+        {
+            perror("pthread_create failed");
+            exit(EXIT_FAILURE);
+        }
+    }
+    memset(total, 0, sizeof(*total));
+    for (int t = 0; t < threads; t++)
+    {
+        pthread_join(workers[t].tid, NULL);
+        for (int p = 0; p < pair_count; p++)
+            for (int r = 0; r < RESULT_KINDS; r++)
+                total->results[p][r] += workers[t].tally.results[p][r];
+        total->moves += workers[t].tally.moves;
+    }
+    uint64_t elapsed = stats_now_ns() - start;
+    free(workers);
+    return elapsed;
+}
+
+static double percent(uint64_t part, uint64_t whole)
+{
+    return whole > 0 ? 100.0 * (double)part / (double)whole : 0.0;
+}
+
+static void print_results(const Tally *total)
+{
+    printf("\n%-8s    %-8s %10s  %8s %8s %8s\n", "A", "B", "games", "A wins", "draws", "B wins");
+    for (int p = 0; p < pair_count; p++)
+    {
+        const uint64_t *r = total->results[p];
+        uint64_t games = r[RESULT_A_WINS] + r[RESULT_DRAW] + r[RESULT_B_WINS];
+        printf("%-8s vs %-8s %10lu  %7.2f%% %7.2f%% %7.2f%%\n", players[pair_a[p]]->name, players[pair_b[p]]->name,
+               (unsigned long)games, percent(r[RESULT_A_WINS], games), percent(r[RESULT_DRAW], games),
+               percent(r[RESULT_B_WINS], games));
+    }
+
+    // 전략별 합계 (자기 자신과의 대국은 제외, 승 1점 무 0.5점)
+    printf("\n%-8s %10s %10s %10s %10s  %6s\n", "strategy", "games", "wins", "draws", "losses", "score");
+    for (int i = 0; i < player_count; i++)
+    {
+        uint64_t win = 0, draw = 0, loss = 0;
+        for (int p = 0; p < pair_count; p++)
+        {
+            const uint64_t *r = total->results[p];
+            if (pair_a[p] == pair_b[p])
+                continue;
+            if (pair_a[p] == i)
+            {
+                win += r[RESULT_A_WINS];
+                loss += r[RESULT_B_WINS];
+                draw += r[RESULT_DRAW];
+            }
+            else if (pair_b[p] == i)
+            {
+                win += r[RESULT_B_WINS];
+                loss += r[RESULT_A_WINS];
+                draw += r[RESULT_DRAW];
+            }
+        }
+        uint64_t games = win + draw + loss;
+        printf("%-8s %10lu %10lu %10lu %10lu  %5.1f%%\n", players[i]->name, (unsigned long)games, (unsigned long)win,
+               (unsigned long)draw, (unsigned long)loss, percent(2 * win + draw, 2 * games));
+    }
+}
+
+// 쉼표로 구분한 전략 이름 목록 (NULL: 등록된 전략 전부)
+static int parse_players(const char *list)
+{
+    if (list == NULL)
+    {
+        for (int i = 0; i < bot_strategy_count && i < MAX_PLAYERS; i++)
+            players[player_count++] = &bot_strategies[i];
+        return 0;
+    }
+    char buf[256];
+    snprintf(buf, sizeof(buf), "%s", list);
+    for (char *save = NULL, *name = strtok_r(buf, ",", &save); name != NULL; name = strtok_r(NULL, ",", &save))
+    {
+        const BotStrategy *strategy = bot_strategy_find(name);
+        if (strategy == NULL || player_count == MAX_PLAYERS)
+        {
+            fprintf(stderr, "unknown strategy or too many strategies: %s\n", name);
+            return -1;
+        }
+        players[player_count++] = strategy;
+    }
+    return player_count > 0 ? 0 : -1;
+}
+
+// -S 로 잴 스레드 수: 1, 2, 4, ... 그리고 마지막은 -t 값
+static int next_thread_count(int t, int max)
+{
+    return t < max && t * 2 > max ? max : t * 2;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s [-g games_per_pair] [-t threads] [-b RxC] [-k k] [-p strategy,...] [-r seed] [-S]\n",
+            prog);
+    fprintf(stderr, "strategies:\n");
+    for (int i = 0; i < bot_strategy_count; i++)
+        fprintf(stderr, "  %-8s %s\n", bot_strategies[i].name, bot_strategies[i].description);
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char *argv[])
+{
+    int threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int sweep = 0;
+    const char *list = NULL;
+    int opt;
+    while ((opt = getopt(argc, argv, "g:t:b:k:p:r:S")) != -1)
+    {
+        switch (opt)
+        {
+        case 'g':
+            games_per_pair = strtoull(optarg, NULL, 10);
+            break;
+        case 't':
+            threads = atoi(optarg);
+            break;
+        case 'b':
+            if (sscanf(optarg, "%dx%d", &rows, &cols) != 2)
+                usage(argv[0]);
+            break;
+        case 'k':
+            k = atoi(optarg);
+            break;
+        case 'p':
+            list = optarg;
+            break;
+        case 'r':
+            base_seed = (unsigned)strtoul(optarg, NULL, 10);
+            break;
+        case 'S':
+            sweep = 1;
+            break;
+        default:
+            usage(argv[0]);
+        }
+    }
+    GameState probe;
+    if (games_per_pair == 0 || threads < 1 || threads > MAX_THREADS || init_game(&probe, rows, cols, k) == -1 ||
+        parse_players(list) == -1)
+        usage(argv[0]);
+
+    for (int a = 0; a < player_count; a++)
+        for (int b = a; b < player_count; b++)
+        {
+            pair_a[pair_count] = a;
+            pair_b[pair_count] = b;
+            pair_count++;
+        }
+    total_games = games_per_pair * (uint64_t)pair_count;
+
+    printf("tournament: %d strategies, %d pairings x %lu games = %lu games on %dx%d k=%d (%ld CPUs)\n", player_count,
+           pair_count, (unsigned long)games_per_pair, (unsigned long)total_games, rows, cols, k,
+           sysconf(_SC_NPROCESSORS_ONLN));
+    printf("%7s  %10s  %9s  %12s  %12s  %10s\n", "threads", "games", "seconds", "games/sec", "moves/sec", "efficiency");
+
+    static Tally total, first;
+    double base_rate = 0;
+    int first_thread_count = sweep ? 1 : threads;
+    for (int t = first_thread_count; t <= threads; t = next_thread_count(t, threads))
+    {
+        uint64_t elapsed = run_tournament(t, &total);
+        double rate = (double)total_games / (elapsed / 1e9);
+        char efficiency[16] = "-";
+        if (t == first_thread_count)
+        {
+            first = total;
+            if (t == 1)
+                base_rate = rate;
+        }
+        else if (memcmp(&first, &total, sizeof(total)) != 0)
+        {
+            fprintf(stderr, "results differ between thread counts\n");
+            return 1;
+        }
+        if (base_rate > 0)
+            snprintf(efficiency, sizeof(efficiency), "%.1f%%", 100.0 * rate / (base_rate * t));
+        printf("%7d  %10lu  %9.3f  %12.0f  %12.0f  %10s\n", t, (unsigned long)total_games, elapsed / 1e9, rate,
+               (double)total.moves / (elapsed / 1e9), efficiency);
+        fflush(stdout);
+    }
+    print_results(&total);
+    return 0;
+}
@@ -0,0 +1,236 @@
+// wire.c
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "wire.h"
+
+// 페이로드 배치
+//  YOUR_TURN : int8 turn, uint8 rows, uint8 cols, uint8 0, int16 last_row, int16 last_col, cells[rows*cols]
+//  MOVE      : int16 row, int16 col, uint32 0, uint64 think_ns
+//  GAME_OVER : int8 winner, uint8 0 x3
+//  INVALID   : 없음
+//  WELCOME   : 없음 (세션/플레이어 ID는 헤더)
+//  REQUEUE   : 없음
+#define TURN_FIXED 8
+#define MOVE_PAYLOAD 16
+#define GAME_OVER_PAYLOAD 4
+
+uint64_t wire_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+size_t wire_encode(const WireMessage *msg, uint8_t *frame, size_t size)
+{
+    size_t length = sizeof(WireHeader);
+    uint8_t *payload = frame + sizeof(WireHeader);
+
+    switch (msg->type)
+    {
+    case WIRE_YOUR_TURN:
+    {
+        size_t cells = (size_t)msg->rows * msg->cols;
+        length += TURN_FIXED + cells;
+        if (length > size || msg->rows > MNK_MAX_SIDE || msg->cols > MNK_MAX_SIDE)
+            return 0;
+        int16_t last[2] = {(int16_t)msg->row, (int16_t)msg->col};
+        payload[0] = (uint8_t)msg->turn;
+        payload[1] = (uint8_t)msg->rows;
+        payload[2] = (uint8_t)msg->cols;
+        payload[3] = 0;
+        memcpy(payload + 4, last, sizeof(last));
+        memcpy(payload + TURN_FIXED, msg->cells, cells);
+        break;
+    }
+    case WIRE_MOVE:
+    {
+        length += MOVE_PAYLOAD;
+        if (length > size)
+            return 0;
+        int16_t move[2] = {(int16_t)msg->row, (int16_t)msg->col};
+        uint32_t zero = 0;
+        memcpy(payload, move, sizeof(move));
+        memcpy(payload + 4, &zero, sizeof(zero));
+        memcpy(payload + 8, &msg->think_ns, sizeof(msg->think_ns));
+        break;
+    }
+    case WIRE_GAME_OVER:
+        length += GAME_OVER_PAYLOAD;
+        if (length > size)
+            return 0;
+        payload[0] = (uint8_t)(int8_t)msg->winner;
+        payload[1] = payload[2] = payload[3] = 0;
+        break;
+    case WIRE_INVALID_MOVE:
+    case WIRE_WELCOME:
+    case WIRE_REQUEUE:
+        if (length > size)
+            return 0;
+        break;
+    default:
+        return 0;
+    }
+
+    WireHeader header;
+    header.length = (uint16_t)length;
+    header.magic = WIRE_MAGIC;
+    header.type = (uint8_t)msg->type;
+    header.session = (uint16_t)msg->session;
+    header.player = (uint8_t)msg->player;
+    header.reserved = 0;
+    header.timestamp_ns = msg->timestamp_ns;
+    memcpy(frame, &header, sizeof(header));
+    return length;
+}
+
+int wire_decode(const uint8_t *frame, size_t length, WireMessage *msg)
+{
+    if (length < sizeof(WireHeader))
+        return -1;
+    WireHeader header;
+    memcpy(&header, frame, sizeof(header));
+    if (header.magic != WIRE_MAGIC || header.length != length)
+        return -1;
+
+    const uint8_t *payload = frame + sizeof(WireHeader);
+    size_t payload_len = length - sizeof(WireHeader);
+    msg->type = header.type;
+    msg->session = header.session;
+    msg->player = header.player;
+    msg->timestamp_ns = header.timestamp_ns;
+
+    switch (header.type)
+    {
+    case WIRE_YOUR_TURN:
+    {
+        if (payload_len < TURN_FIXED)
+            return -1;
+        int16_t last[2];
+        msg->turn = (int8_t)payload[0];
+        msg->rows = payload[1];
+        msg->cols = payload[2];
+        memcpy(last, payload + 4, sizeof(last));
+        msg->row = last[0];
+        msg->col = last[1];
+        size_t cells = (size_t)msg->rows * msg->cols;
+        if (msg->rows > MNK_MAX_SIDE || msg->cols > MNK_MAX_SIDE || payload_len != TURN_FIXED + cells)
+            return -1;
+        memcpy(msg->cells, payload + TURN_FIXED, cells);
+        return 0;
+    }
+    case WIRE_MOVE:
+    {
+        if (payload_len != MOVE_PAYLOAD)
+            return -1;
+        int16_t move[2];
+        memcpy(move, payload, sizeof(move));
+        msg->row = move[0];
+        msg->col = move[1];
+        memcpy(&msg->think_ns, payload + 8, sizeof(msg->think_ns));
+        return 0;
+    }
+    case WIRE_GAME_OVER:
+        if (payload_len != GAME_OVER_PAYLOAD)
+            return -1;
+        msg->winner = (int8_t)payload[0];
+        return 0;
+    case WIRE_INVALID_MOVE:
+    case WIRE_WELCOME:
+    case WIRE_REQUEUE:
+        return payload_len == 0 ? 0 : -1;
+    default:
+        return -1;
+    }
+}
+
+void wire_reader_init(WireReader *reader)
+{
+    reader->start = 0;
+    reader->end = 0;
+}
+
+// 처리한 바이트를 버리고 남은 바이트를 버퍼 앞으로 이동
+static void reader_compact(WireReader *reader)
+{
+    if (reader->start == 0)
+        return;
+    size_t pending = reader->end - reader->start;
+    memmove(reader->data, reader->data + reader->start, pending);
+    reader->start = 0;
+    reader->end = pending;
+}
+
+size_t wire_reader_push(WireReader *reader, const void *data, size_t length)
+{
+    if (reader->end + length > sizeof(reader->data))
+        reader_compact(reader);
+    size_t space = sizeof(reader->data) - reader->end;
+    if (length > space)
+        length = space;
+    memcpy(reader->data + reader->end, data, length);
+    reader->end += length;
+    return length;
+}
+
+ssize_t wire_reader_fill(WireReader *reader, int fd)
+{
+    if (reader->end + WIRE_MAX_FRAME > sizeof(reader->data))
+        reader_compact(reader);
+    ssize_t n;
+    do
+        n = read(fd, reader->data + reader->end, sizeof(reader->data) - reader->end);
+    while (n == -1 && errno == EINTR);
+    if (n > 0)
+        reader->end += (size_t)n;
+    return n;
+}
+
+int wire_reader_next(WireReader *reader, WireMessage *msg)
+{
+    size_t pending = reader->end - reader->start;
+    if (pending < sizeof(uint16_t) + 1)
+        return 0;
+    const uint8_t *frame = reader->data + reader->start;
+    uint16_t length;
+    memcpy(&length, frame, sizeof(length));
+    if (frame[2] != WIRE_MAGIC || length < sizeof(WireHeader) || length > WIRE_MAX_FRAME)
+        return WIRE_CORRUPT; // 프레임 경계를 잃어버림
+    if (pending < length)
+        return 0; // 나머지 바이트가 아직 도착하지 않음
+    reader->start += length;
+    if (reader->start == reader->end)
+        reader->start = reader->end = 0;
+    return wire_decode(frame, length, msg) == 0 ? 1 : WIRE_CORRUPT;
+}
+
+int wire_send(int fd, const WireMessage *msg)
+{
+    uint8_t frame[WIRE_MAX_FRAME];
+    size_t length = wire_encode(msg, frame, sizeof(frame));
+    if (length == 0)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+    ssize_t n;
+    do
+        n = write(fd, frame, length);
+    while (n == -1 && errno == EINTR);
+    return n == (ssize_t)length ? 0 : -1;
+}
+
+int wire_recv(WireReader *reader, int fd, WireMessage *msg)
+{
+    for (;;)
+    {
+        int rc = wire_reader_next(reader, msg);
+        if (rc != 0)
+            return rc;
+        ssize_t n = wire_reader_fill(reader, fd);
+        if (n <= 0)
+            return (int)n;
+    }
+}
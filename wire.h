@@ -0,0 +1,78 @@
+// wire.h
+// FIFO 전송용 길이 접두 이진 메시지 형식
+//  모든 프레임은 WireHeader(16바이트)로 시작하며 length 는 헤더를 포함한 전체 길이
+//  한 번의 read 로 프레임이 잘려 오거나 여러 프레임이 붙어 와도 WireReader 가 재조립
+#ifndef WIRE_H
+#define WIRE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+#include "mnk_board.h"
+
+#define WIRE_MAGIC 0x7e     // 프레임 시작 표식 (손상된 스트림 감지용)
+#define WIRE_MAX_FRAME 512  // PIPE_BUF 이하: 프레임 하나는 write 한 번에 원자적으로 기록됨
+#define WIRE_READER_SIZE 4096
+#define WIRE_CORRUPT (-2)   // 손상된 프레임 (wire_reader_next / wire_recv 반환값)
+#define WIRE_LOBBY_SESSION 0xffff // WELCOME: 아직 상대가 없어 대기열에서 기다리는 중
+
+typedef enum
+{
+    WIRE_YOUR_TURN = 1, // 서버 -> 클라이언트: 차례 알림 + 게임판
+    WIRE_MOVE,          // 클라이언트 -> 서버: 수 (row, col, 입력 시간)
+    WIRE_INVALID_MOVE,  // 서버 -> 클라이언트: 잘못된 수
+    WIRE_GAME_OVER,     // 서버 -> 클라이언트: 게임 종료 + 승자
+    WIRE_WELCOME,       // 서버 -> 클라이언트: 대기열 입장(세션 WIRE_LOBBY_SESSION) 또는 배정된 세션/플레이어 ID
+    WIRE_REQUEUE,       // 클라이언트 -> 서버: 게임이 끝난 뒤 다시 대기열로
+} WireType;
+
+typedef struct // 프레임 헤더 (16바이트, 같은 호스트 안에서만 쓰므로 호스트 바이트 순서)
+{
+    uint16_t length;       // 헤더 포함 프레임 길이
+    uint8_t magic;         // WIRE_MAGIC
+    uint8_t type;          // WireType
+    uint16_t session;      // 세션 ID
+    uint8_t player;        // 보낸/받는 플레이어 ID
+    uint8_t reserved;
+    uint64_t timestamp_ns; // 보낸 쪽 CLOCK_MONOTONIC 시각
+} WireHeader;
+
+typedef struct // 디코딩된 메시지
+{
+    int type;
+    int session;
+    int player;
+    uint64_t timestamp_ns;
+    int row, col;      // MOVE: 둘 칸, YOUR_TURN: 마지막 수 (-1: 없음)
+    uint64_t think_ns; // MOVE: 클라이언트 입력 시간
+    int turn;          // YOUR_TURN: 현재 차례
+    int winner;        // GAME_OVER: 승자 (0, 1, 2: 무승부, -1: 없음)
+    int rows, cols;    // YOUR_TURN: 게임판 크기
+    signed char cells[MNK_MAX_CELLS]; // YOUR_TURN: MNK_EMPTY, 0, 1
+} WireMessage;
+
+typedef struct // 수신 재조립 버퍼
+{
+    uint8_t data[WIRE_READER_SIZE];
+    size_t start, end; // 아직 처리하지 않은 바이트 [start, end)
+} WireReader;
+
+uint64_t wire_now_ns(void);
+
+// 메시지를 프레임으로 인코딩, 프레임 길이 반환 (버퍼 부족 시 0)
+size_t wire_encode(const WireMessage *msg, uint8_t *frame, size_t size);
+// 프레임 하나를 디코딩 (0: 성공, -1: 잘못된 프레임)
+int wire_decode(const uint8_t *frame, size_t length, WireMessage *msg);
+
+void wire_reader_init(WireReader *reader);
+size_t wire_reader_push(WireReader *reader, const void *data, size_t length); // 메모리에서 바이트 추가
+ssize_t wire_reader_fill(WireReader *reader, int fd);                         // read 한 번으로 채움
+// 완성된 프레임 하나를 꺼냄 (1: 메시지, 0: 바이트 부족, WIRE_CORRUPT: 손상된 스트림)
+int wire_reader_next(WireReader *reader, WireMessage *msg);
+
+// 프레임 하나를 write 한 번으로 전송 (0: 성공, -1: 실패)
+int wire_send(int fd, const WireMessage *msg);
+// 메시지 하나를 받을 때까지 대기 (1: 메시지, 0: EOF, -1: read 오류, WIRE_CORRUPT: 손상된 스트림)
+int wire_recv(WireReader *reader, int fd, WireMessage *msg);
+
+#endif
@@ -0,0 +1,253 @@
+// work_pool.c
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "work_pool.h"
+
+static __thread WorkWorker *current_worker; // 작업자 스레드 안에서만 설정
+
+// 주인만 호출: 맨 아래에 넣기 (0: 성공, -1: 가득 참)
+static int deque_push(WorkDeque *deque, WorkTask *task)
+{
+    long bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+    long top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    if (bottom - top >= WORK_DEQUE_SIZE)
+        return -1;
+    atomic_store_explicit(&deque->tasks[bottom & WORK_DEQUE_MASK], task, memory_order_relaxed);
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_release); // 작업 내용을 먼저 공개
+    return 0;
+}
+
+// 주인만 호출: 맨 아래에서 꺼내기 (마지막 하나는 훔치는 쪽과 top CAS 로 경쟁)
+static WorkTask *deque_pop(WorkDeque *deque)
+{
+    long bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+    atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst); // bottom 감소가 top 읽기보다 먼저 보이도록
+    long top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+    if (top > bottom)
+    {
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed); // 비어 있음
+        return NULL;
+    }
+    WorkTask *task = atomic_load_explicit(&deque->tasks[bottom & WORK_DEQUE_MASK], memory_order_relaxed);
+    if (top == bottom)
+    {
+        if (!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1, memory_order_seq_cst,
+                                                     memory_order_relaxed))
+            task = NULL; // 훔치는 쪽이 먼저 가져감
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+    }
+    return task;
+}
+
+// 다른 작업자가 호출: 맨 위에서 훔치기 (경쟁에서 지면 NULL)
+static WorkTask *deque_steal(WorkDeque *deque)
+{
+    long top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    long bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+    if (top >= bottom)
+        return NULL;
+    WorkTask *task = atomic_load_explicit(&deque->tasks[top & WORK_DEQUE_MASK], memory_order_relaxed);
+    if (!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1, memory_order_seq_cst,
+                                                 memory_order_relaxed))
+        return NULL;
+    return task;
+}
+
+// 잠든 작업자가 있으면 하나 깨움 (훔쳐 갈 작업이 생겼거나 주입 대기열에 작업이 들어옴)
+static void wake_one(WorkPool *pool)
+{
+    if (atomic_load_explicit(&pool->sleepers, memory_order_relaxed) == 0)
+        return;
+    pthread_mutex_lock(&pool->lock);
+    pthread_cond_signal(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+// 주입 대기열에서 최대 WORK_INJECT_BATCH 개를 가져와 첫 작업은 반환, 나머지는 자기 덱에 넣음
+static WorkTask *take_injected(WorkPool *pool, WorkWorker *self)
+{
+    if (atomic_load_explicit(&pool->injected, memory_order_relaxed) == 0)
+        return NULL;
+    pthread_mutex_lock(&pool->lock);
+    WorkTask *first = pool->inject_head;
+    WorkTask *task = first;
+    long taken = 0;
+    while (task != NULL && taken < WORK_INJECT_BATCH)
+    {
+        WorkTask *next = task->next;
+        if (taken > 0 && deque_push(&self->deque, task) == -1)
+            break;
+        taken++;
+        task = next;
+    }
+    pool->inject_head = task;
+    if (task == NULL)
+        pool->inject_tail = NULL;
+    atomic_fetch_sub_explicit(&pool->injected, taken, memory_order_relaxed);
+    pthread_mutex_unlock(&pool->lock);
+    if (taken > 1)
+        wake_one(pool);
+    return first;
+}
+
+// 임의의 작업자부터 차례로 한 번씩 훔쳐 봄
+static WorkTask *steal_any(WorkPool *pool, WorkWorker *self)
+{
+    int start = rand_r(&self->seed) % pool->count;
+    for (int i = 0; i < pool->count; i++)
+    {
+        WorkWorker *victim = &pool->workers[(start + i) % pool->count];
+        if (victim == self)
+            continue;
+        WorkTask *task = deque_steal(&victim->deque);
+        if (task != NULL)
+            return task;
+    }
+    return NULL;
+}
+
+// 주입 대기열이 빌 때까지 잠듦 (다른 작업자의 덱에 작업이 생기면 wake_one 이 깨움)
+static void worker_sleep(WorkPool *pool)
+{
+    pthread_mutex_lock(&pool->lock);
+    atomic_fetch_add_explicit(&pool->sleepers, 1, memory_order_relaxed);
+    if (atomic_load_explicit(&pool->injected, memory_order_relaxed) == 0 &&
+        !atomic_load_explicit(&pool->stop, memory_order_relaxed))
+        pthread_cond_wait(&pool->wake, &pool->lock);
+    atomic_fetch_sub_explicit(&pool->sleepers, 1, memory_order_relaxed);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+static void *worker_main(void *arg)
+{
+    WorkWorker *self = (WorkWorker *)arg;
+    WorkPool *pool = self->pool;
+    current_worker = self;
+
+    while (!atomic_load_explicit(&pool->stop, memory_order_acquire))
+    {
+        // 자기 덱 -> 주입 대기열 -> 다른 작업자 덱 순서로 찾음
+        WorkTask *task = deque_pop(&self->deque);
+        if (task == NULL)
+            task = take_injected(pool, self);
+        if (task == NULL && (task = steal_any(pool, self)) != NULL)
+            self->stolen++;
+        if (task == NULL)
+        {
+            worker_sleep(pool);
+            continue;
+        }
+        self->executed++;
+        task->run(task);
+    }
+    return NULL;
+}
+
+int work_pool_cpus(void)
+{
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return cpus > 0 ? (int)cpus : 1;
+}
+
+int work_pool_init(WorkPool *pool, int count, size_t stack_size)
+{
+    memset(pool, 0, sizeof(*pool));
+    if (count <= 0)
+        count = work_pool_cpus();
+    // 덱이 캐시 라인 단위로 정렬되어야 하므로 aligned_alloc 사용
+    size_t bytes = ((sizeof(WorkWorker) * count + WORK_CACHE_LINE - 1) / WORK_CACHE_LINE) * WORK_CACHE_LINE;
+    pool->workers = aligned_alloc(WORK_CACHE_LINE, bytes);
+    if (pool->workers == NULL)
+    {
+        perror("Failed to allocate worker pool");
+        return -1;
+    }
+    memset(pool->workers, 0, bytes);
+    pool->count = count;
+    pool->stack_size = stack_size;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    for (int i = 0; i < count; i++)
+    {
+        WorkWorker *worker = &pool->workers[i];
+        worker->pool = pool;
+        worker->id = i;
+        worker->seed = (unsigned)i * 2654435761u + 1;
+    }
+    return 0;
+}
+
+int work_pool_start(WorkPool *pool)
+{
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    if (pool->stack_size > 0)
+        pthread_attr_setstacksize(&attr, pool->stack_size);
+    for (int i = 0; i < pool->count; i++)
+    {
+        if (pthread_create(&pool->workers[i].thread, &attr, worker_main, &pool->workers[i]) != 0)
+        {
+            perror("Failed to create worker thread");
+            pool->count = i; // 만든 작업자만 종료 대기
+            pthread_attr_destroy(&attr);
+            return -1;
+        }
+    }
+    pthread_attr_destroy(&attr);
+    return 0;
+}
+
+void work_pool_submit(WorkPool *pool, WorkTask *task)
+{
+    WorkWorker *self = current_worker;
+    if (self != NULL && self->pool == pool && deque_push(&self->deque, task) == 0)
+    {
+        wake_one(pool); // 잠든 작업자가 훔쳐 갈 수 있도록
+        return;
+    }
+    task->next = NULL;
+    pthread_mutex_lock(&pool->lock);
+    if (pool->inject_tail != NULL)
+        pool->inject_tail->next = task;
+    else
+        pool->inject_head = task;
+    pool->inject_tail = task;
+    atomic_fetch_add_explicit(&pool->injected, 1, memory_order_relaxed);
+    if (atomic_load_explicit(&pool->sleepers, memory_order_relaxed) > 0)
+        pthread_cond_signal(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+void work_pool_stop(WorkPool *pool)
+{
+    pthread_mutex_lock(&pool->lock);
+    atomic_store_explicit(&pool->stop, 1, memory_order_release);
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+    for (int i = 0; i < pool->count; i++)
+        pthread_join(pool->workers[i].thread, NULL);
+}
+
+void work_pool_destroy(WorkPool *pool)
+{
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->wake);
+    free(pool->workers);
+    pool->workers = NULL;
+    pool->count = 0;
+}
+
+void work_pool_totals(const WorkPool *pool, long *executed, long *stolen)
+{
+    *executed = 0;
+    *stolen = 0;
+    for (int i = 0; i < pool->count; i++)
+    {
+        *executed += pool->workers[i].executed;
+        *stolen += pool->workers[i].stolen;
+    }
+}
@@ -0,0 +1,66 @@
+// work_pool.h
+// 고정 크기 작업자 풀: 코어마다 작업자 스레드 하나, 작업자마다 작업 훔치기(work-stealing) 덱
+//  작업자는 자기 덱의 아래쪽(bottom)에서 넣고 꺼내며, 일이 없으면 다른 작업자 덱의 위쪽(top)에서 훔침
+//  풀 밖의 스레드(이벤트 대기 스레드 등)가 넣는 작업은 전역 주입 대기열로 들어가고,
+//  작업자가 한 번에 여러 개를 자기 덱으로 가져가서 나머지 작업자가 훔쳐 갈 수 있게 함
+//  작업은 WorkTask 를 품은 구조체로 표현 (별도 할당 없음)
+#ifndef WORK_POOL_H
+#define WORK_POOL_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stddef.h>
+
+#define WORK_DEQUE_SIZE 1024 // 작업자 덱 용량 (2의 거듭제곱)
+#define WORK_DEQUE_MASK (WORK_DEQUE_SIZE - 1)
+#define WORK_INJECT_BATCH 32 // 주입 대기열에서 한 번에 가져가는 최대 작업 수
+#define WORK_CACHE_LINE 64
+
+struct WorkPool;
+
+typedef struct WorkTask
+{
+    void (*run)(struct WorkTask *task); // 작업자 스레드에서 실행
+    struct WorkTask *next;              // 주입 대기열 연결
+} WorkTask;
+
+typedef struct // Chase-Lev 덱 (주인은 bottom, 훔치는 쪽은 top 을 CAS 로 증가)
+{
+    _Alignas(WORK_CACHE_LINE) _Atomic long top;
+    _Alignas(WORK_CACHE_LINE) _Atomic long bottom;
+    _Alignas(WORK_CACHE_LINE) WorkTask *_Atomic tasks[WORK_DEQUE_SIZE];
+} WorkDeque;
+
+typedef struct
+{
+    WorkDeque deque;
+    struct WorkPool *pool;
+    int id;
+    pthread_t thread;
+    unsigned seed;           // 훔칠 상대를 고르는 난수 상태
+    long executed, stolen;   // 실행한 작업 수, 그중 훔쳐 온 작업 수
+} WorkWorker;
+
+typedef struct WorkPool
+{
+    int count;               // 작업자 수
+    WorkWorker *workers;
+    pthread_mutex_t lock;    // 주입 대기열, 잠든 작업자 보호
+    pthread_cond_t wake;
+    WorkTask *inject_head, *inject_tail;
+    _Atomic long injected;   // 주입 대기열에 있는 작업 수 (잠금 없이 비었는지 확인)
+    _Atomic int sleepers;    // 일이 없어 잠든 작업자 수
+    _Atomic int stop;
+    size_t stack_size;       // 작업자 스택 크기 (0: 기본값)
+} WorkPool;
+
+int work_pool_cpus(void); // 온라인 CPU 수 (기본 작업자 수)
+int work_pool_init(WorkPool *pool, int count, size_t stack_size);
+int work_pool_start(WorkPool *pool);
+// 작업 넣기: 작업자 스레드에서 부르면 자기 덱에, 그 밖에서는 주입 대기열에 넣고 잠든 작업자를 깨움
+void work_pool_submit(WorkPool *pool, WorkTask *task);
+void work_pool_stop(WorkPool *pool); // 남은 작업을 버리고 작업자 종료 대기
+void work_pool_destroy(WorkPool *pool);
+void work_pool_totals(const WorkPool *pool, long *executed, long *stolen);
+
+#endif